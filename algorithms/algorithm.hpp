@@ -12,6 +12,7 @@
 #include <stdexcept>
 #include <string>
 #include "../constants.hpp"
+#include "stuff/increments_history.hpp"
 #include "stuff/input_data.hpp"
 #include "stuff/output_data.hpp"
 
@@ -31,6 +32,12 @@
  * алгоритм найдёт решения для следующих моментов времени:
  * 0; step; 2*step; ... ; last_time).
  *
+ * Алгоритм хранит историю входных данных на последних отрезках (см. класс
+ * increments_history и метод get_history_capacity_()), так что многошаговым
+ * алгоритмам не приходится повторно интегрировать уже пройденные отрезки.
+ * Длину отрезка истории задаёт класс-потомок (см. get_history_interval_()):
+ * по умолчанию это шаг step, у итеративных алгоритмов - подотрезок шага.
+ *
  * @tparam Q Выбранная алгебра (кватернионы/бикватернионы).
  * @tparam I Выбранный тип входных данных (классы-потомки, как правило, будут жёстко фиксировать этот тип в соответствии с их потребностями).
  */
@@ -110,13 +117,38 @@ protected:
 	//! Время, до которого должен работать алгоритм.
 	long double last_time_;
 
+	//! История входных данных на последних отрезках длины get_history_interval_() (очищается при каждом запуске алгоритма).
+	increments_history<I> history_;
+
+
+	/** Возвращает ёмкость истории входных данных (см. history_).
+	 *
+	 * По умолчанию равна нулю (история не хранится). Алгоритмы, которые
+	 * используют входные данные на нескольких последних отрезках, должны
+	 * переопределять этот метод.
+	 */
+	virtual size_t get_history_capacity_() {
+		return 0;
+	}
+
+	/** Возвращает длину отрезка истории входных данных (см. history_).
+	 *
+	 * Отрезок с номером idx (начиная с единицы) в истории - это
+	 * [(idx-1) * длина; idx * длина]. По умолчанию длина равна шагу step;
+	 * классы-потомки, которые складывают в историю данные на подотрезках
+	 * шага, должны переопределять этот метод.
+	 */
+	virtual long double get_history_interval_() {
+		return step_;
+	}
+
 	/** Возвращает созданную и подготовленную структуру output_data.
 	 *
 	 * А именно, в ней заполняется список времён ts, в которые надо посчитать
-	 * решение.
+	 * решение (см. output_data::init_grid()).
 	 *
 	 * Также списку qs сразу выделяется нужный размер, а в нулевой элемент
-	 * записывается начальное решение.
+	 * записывается начальное решение, и очищается история входных данных.
 	 *
 	 * @throws std::logic_exception Кидает исключение, если заранее не были выставлены параметры step или last_time.
 	 */
@@ -127,12 +159,10 @@ protected:
 			throw new std::logic_error ("Перед запуском алгоритма должно быть указано корректное значение параметра last_time.");
 
 		t_output_data_ptr result (new t_output_data);
-
-		for (long double t=0; t<=last_time_+EPS; t+=step_)
-			result->ts.push_back (t);
-		result->qs.resize (result->ts.size());
+		result->init_grid (step_, last_time_);
 
 		result->qs[0] = input_data_->get_initial_solution();
+		history_.reset (get_history_capacity_());
 
 		return result;
 	}
@@ -147,11 +177,23 @@ protected:
 		return input_data_->get_integrated (t1, t2);
 	}
 
-	//! Возвращает интегральные входные данные на idx-ом по счёту отрезке (начиная с единицы).
+	/** Возвращает интегральные входные данные на idx-ом по счёту отрезке истории (начиная с единицы).
+	 *
+	 * Отрезки имеют длину get_history_interval_(). Если отрезок есть в
+	 * истории (см. history_), данные берутся оттуда. Если это очередной
+	 * отрезок, то полученные данные добавляются в историю.
+	 */
 	I get_integrated_data (size_t idx) {
-		long double t1 = step_ * (idx - 1),
-			t2 = t1 + step_;
-		return input_data_->get_integrated (t1, t2);
+		if (history_.contains (idx))
+			return history_[idx];
+
+		long double interval = get_history_interval_();
+		long double t1 = interval * (idx - 1),
+			t2 = t1 + interval;
+		I value = input_data_->get_integrated (t1, t2);
+		if (idx == history_.get_next_index())
+			history_.push (value);
+		return value;
 	}
 
 
@@ -1,5 +1,9 @@
 /** \file 2_step.hpp
     \brief Содержит алгоритм "auto_generated_2_step_algorithm" - автоматически сгенерированный двухшаговый алгоритм.
+
+	Сгенерировано программой tools/algorithm_generator по описанию tools/algorithm_generator/2_step.txt -
+	не редактировать вручную. Решение на шаге: 24 операций с плавающей
+	точкой (при вычислении кватернионных произведений в лоб - 153).
 */
 
 #pragma once
@@ -8,12 +12,14 @@
 
 
 
-#include <cmath>
 #include "../algorithm.hpp"
+#include "../stuff/rotation_functions.hpp"
 
 
 
 /** Класс "auto_generated_2_step_algorithm" - автоматически сгенерированный двухшаговый алгоритм.
+ *
+ * Алгебра Q должна строиться по скалярной и векторной частям: Q (s, v).
  */
 template <typename Q, typename I>
 class auto_generated_2_step_algorithm : public algorithm<Q,I> {
@@ -24,26 +30,24 @@ public:
 	//! Запускает алгоритм, возвращая полученные результаты работы.
 	virtual typename algorithm<Q, I>::t_output_data_ptr execute() {
 		typename algorithm<Q, I>::t_output_data_ptr result = this->init_output_data_();
+		typedef typename I::value_type t_scalar;
 
 		for (size_t i=1; i<result->get_count(); ++i) {
-			I phi = this->input_data_->get_integrated (result->ts[i-1], result->ts[i]);
-			quaternion lambda;
-
-			if (i == 1) {
-				long double phi_m = phi.length();
+			I omega1 = this->get_integrated_data (i);
+			Q lambda;
 
-				lambda = quaternion (
-					cos (phi_m / 2),
-					phi * sin (phi_m / 2) / phi_m
-				);
-			}
+			if (i < 2)
+				lambda = rotation_quaternion<Q> (omega1);
 			else {
-				I phi2 = this->input_data_->get_integrated (result->ts[i-2], result->ts[i-1]);
-				
-				Q omega1 = phi;
-				Q omega2 = phi2;
-
-				lambda = quaternion(1) + 0.5 * omega1 + 17.0/192 * omega1*omega1 + 1./64 * omega1*omega2 + 1./64 * omega2*omega1 + 1./192 * omega2*omega2;
+				I omega2 = this->get_integrated_data (i - 1);
+
+				t_scalar dot_omega1_omega1 = dotProduct (omega1, omega1);
+				t_scalar dot_omega1_omega2 = dotProduct (omega1, omega2);
+				t_scalar dot_omega2_omega2 = dotProduct (omega2, omega2);
+				lambda = Q (
+					t_scalar (1) - t_scalar (17) / 192 * dot_omega1_omega1 - t_scalar (1) / 32 * dot_omega1_omega2 - t_scalar (1) / 192 * dot_omega2_omega2,
+					omega1 * (t_scalar (1) / 2)
+				);
 			}
 
 			(*result)[i] = (*result)[i-1] * lambda;
@@ -53,6 +57,18 @@ public:
 	}
 
 
+protected:
+
+
+	//! Алгоритму нужны входные данные на текущем и предыдущем отрезках.
+	virtual size_t get_history_capacity_() {
+		return 2;
+	}
+
+
+public:
+
+
 	//! Возвращает название алгоритма в виде строки.
 	virtual std::string get_algorithm_title() {
 		return "Автоматически сгенерированный алгоритм (2-шаговый)";
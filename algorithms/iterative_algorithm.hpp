@@ -11,8 +11,15 @@
 
 
 
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "algorithm.hpp"
+#include "stuff/iterate_steps.hpp"
+#include "stuff/solution_accumulator.hpp"
 
 
 
@@ -36,6 +43,18 @@
  * меньше дискретности входных данных) классы-потомки могут задавать,
  * переопределяя метод get_algorithm_steps_count_().
  *
+ * Входные данные на каждом подотрезке (длины step/шаговость) по мере
+ * получения добавляются в историю (см. algorithm::history_), так что
+ * get_local_solution_() может использовать и данные на предыдущих шагах,
+ * если класс-потомок задал достаточную ёмкость истории.
+ *
+ * Алгоритм можно запускать в параллельном режиме (см. set_parallel()), а
+ * ответ - накапливать с повышенной точностью (см. set_accumulation()).
+ *
+ * Помимо пакетного запуска (execute()), алгоритм можно использовать в
+ * потоковом режиме, передавая ему входные данные по мере их поступления
+ * (см. start_stream()).
+ *
  * @tparam Q Выбранная алгебра (кватернионы/бикватернионы).
  * @tparam I Выбранный тип входных данных (классы-потомки, как правило, будут жёстко фиксировать этот тип в соответствии с их потребностями).
  */
@@ -45,10 +64,151 @@ class iterative_algorithm : public algorithm<Q,I> {
 public:
 
 
+	iterative_algorithm()
+		: parallel_ (false),
+		  accumulation_ (native_accumulation),
+		  stream_accumulator_ (native_accumulation, Q()),
+		  stream_pending_ (0),
+		  stream_steps_ (0)
+	{ }
+
 	virtual ~iterative_algorithm() {
 	}
 
 
+	/** Включает или выключает параллельный режим.
+	 *
+	 * Решения на отрезках (см. get_local_solution_()) зависят только от
+	 * входных данных, а последовательная зависимость есть лишь в их
+	 * перемножении. Поэтому в параллельном режиме решения на отрезках
+	 * вычисляются параллельно, а их произведения - параллельным
+	 * префиксным сканированием (см. execute_parallel_()).
+	 *
+	 * Входные данные по-прежнему запрашиваются последовательно, а метод
+	 * get_local_solution_() вызывается одновременно из нескольких потоков,
+	 * т.е. должен быть потокобезопасным (для алгоритмов, которые вычисляют
+	 * решение только по переданным входным данным, это так). Алгебра Q
+	 * должна предоставлять функцию normalize() (см. quaternion.hpp).
+	 *
+	 * История входных данных в параллельном режиме не ведётся: решения на
+	 * отрезках сегмента вычисляются не по порядку, так что
+	 * get_integrated_data() увидел бы не то окно, а при промахе обращался бы
+	 * к источнику данных из нескольких потоков сразу (источники данных не
+	 * реентерабельны). Поэтому параллельный режим доступен только
+	 * алгоритмам с нулевой ёмкостью истории (см. get_history_capacity_()).
+	 *
+	 * Параллелизм обеспечивается OpenMP; без него (или с одним потоком)
+	 * результаты совпадают с последовательным режимом.
+	 *
+	 * По умолчанию режим выключен.
+	 *
+	 * @throws std::logic_error Кидает исключение при попытке включить параллельный режим для алгоритма с ненулевой ёмкостью истории.
+	 */
+	void set_parallel (bool enabled) {
+		if (enabled)
+			check_parallel_history_();
+		parallel_ = enabled;
+	}
+
+	//! Возвращает, включён ли параллельный режим (см. set_parallel()).
+	bool get_parallel() const {
+		return parallel_;
+	}
+
+
+	/** Задаёт способ накопления ответа (см. accumulation_mode).
+	 *
+	 * Основная часть погрешности на длинных прогонах набегает не в решениях
+	 * на отрезках, а при их последовательном перемножении. Поэтому, если
+	 * алгоритм работает, скажем, над кватернионами с компонентами типа
+	 * double, ответ можно хранить в long double или в двойной-двойной
+	 * точности (см. solution_accumulator), а в выходные данные записывать
+	 * его округление.
+	 *
+	 * Действует только в последовательном режиме (см. set_parallel()).
+	 * По умолчанию - native_accumulation.
+	 */
+	void set_accumulation (accumulation_mode mode) {
+		accumulation_ = mode;
+	}
+
+	//! Возвращает способ накопления ответа (см. set_accumulation()).
+	accumulation_mode get_accumulation() const {
+		return accumulation_;
+	}
+
+
+	/** Начинает потоковую обработку входных данных с начальным решением initial.
+	 *
+	 * В потоковом режиме источник входных данных (см. set_input_data()) и
+	 * время last_time не используются: входные данные на подотрезках длины
+	 * step/шаговость передаются методом push_increment() по одному, а
+	 * текущий ответ возвращает get_orientation(). Используются те же
+	 * get_local_solution_() и история входных данных, что и в execute(), и
+	 * тот же способ накопления ответа (см. set_accumulation()).
+	 *
+	 * Вся память выделяется здесь, так что сами обновления память не
+	 * выделяют (если её не выделяет get_local_solution_()), а состояние
+	 * алгоритма ограничено историей и данными одного шага.
+	 */
+	void start_stream (const Q & initial) {
+		stream_gamma_.resize (this->get_algorithm_steps_count_());
+		stream_pending_ = 0;
+		stream_steps_ = 0;
+		stream_accumulator_ = solution_accumulator<Q> (accumulation_, initial);
+		stream_orientation_ = initial;
+		this->history_.reset (this->get_history_capacity_());
+	}
+
+
+	/** Передаёт входные данные на очередном подотрезке (см. start_stream()).
+	 *
+	 * Как только накопится столько подотрезков, какова шаговость алгоритма,
+	 * вычисляется решение на шаге и обновляется текущий ответ.
+	 *
+	 * @return Обновился ли текущий ответ.
+	 * @throws std::logic_error Кидает исключение, если потоковая обработка не была начата.
+	 */
+	bool push_increment (const I & increment) {
+		if (stream_gamma_.empty())
+			throw std::logic_error ("Перед передачей входных данных нужно вызвать start_stream().");
+
+		stream_gamma_[stream_pending_++] = increment;
+		if (this->history_.get_capacity())
+			this->history_.push (increment);
+		if (stream_pending_ < stream_gamma_.size())
+			return false;
+
+		stream_pending_ = 0;
+		++stream_steps_;
+		Q q = this->get_local_solution_ (this->step_ * stream_steps_, stream_gamma_);
+		stream_orientation_ = stream_accumulator_.multiply (q);
+		return true;
+	}
+
+	/** Передаёт входные данные сразу на count подряд идущих подотрезках (см. push_increment()).
+	 *
+	 * @return Обновился ли текущий ответ хотя бы раз.
+	 */
+	bool push_increments (const I * increments, size_t count) {
+		bool updated = false;
+		for (size_t k=0; k<count; ++k)
+			updated = push_increment (increments[k]) || updated;
+		return updated;
+	}
+
+
+	//! Возвращает текущий ответ потоковой обработки (см. start_stream()).
+	const Q & get_orientation() const {
+		return stream_orientation_;
+	}
+
+	//! Возвращает число шагов, пройденных с начала потоковой обработки (ответ соответствует моменту step * это число).
+	size_t get_stream_steps_count() const {
+		return stream_steps_;
+	}
+
+
 protected:
 
 
@@ -65,6 +225,12 @@ protected:
 	}
 
 
+	//! Отрезки истории - подотрезки шага (длины step/шаговость), см. algorithm::get_history_interval_().
+	virtual long double get_history_interval_() {
+		return this->step_ / this->get_algorithm_steps_count_();
+	}
+
+
 	/** Вычисляет решение на текущем временном отрезке.
 	 *
 	 * @param t Время, в которое требуется найти решение.
@@ -76,6 +242,35 @@ protected:
 private:
 
 
+	//! Включён ли параллельный режим (см. set_parallel()).
+	bool parallel_;
+	//! Способ накопления ответа (см. set_accumulation()).
+	accumulation_mode accumulation_;
+
+	//! Входные данные на текущем шаге потоковой обработки (см. start_stream()).
+	std::vector<I> stream_gamma_;
+	//! Накопитель ответа потоковой обработки.
+	solution_accumulator<Q> stream_accumulator_;
+	//! Текущий ответ потоковой обработки.
+	Q stream_orientation_;
+	//! Число подотрезков текущего шага, для которых уже получены входные данные.
+	size_t stream_pending_;
+	//! Число пройденных шагов потоковой обработки.
+	size_t stream_steps_;
+
+
+	//! Функтор, вызывающий get_local_solution_() (см. iterate_steps()).
+	struct local_solution_caller_ {
+		explicit local_solution_caller_ (iterative_algorithm * that)
+			: that(that)
+		{ }
+		Q operator() (long double t, const std::vector<I> & gamma) const {
+			return that->get_local_solution_ (t, gamma);
+		}
+		iterative_algorithm * that;
+	};
+
+
 	/** Запускает алгоритм, возвращая полученные результаты работы.
 	 *
 	 * Этот метод полностью реализуется здесь, поэтому всё, что должны
@@ -84,31 +279,124 @@ private:
 	 */
 	virtual typename algorithm<Q,I>::t_output_data_ptr execute() {
 		typename algorithm<Q,I>::t_output_data_ptr result = this->init_output_data_();
+		if (parallel_) {
+			execute_parallel_ (*result);
+			return result;
+		}
+
+		std::vector<I> gamma (this->get_algorithm_steps_count_());
+		solution_accumulator<Q> accumulator (accumulation_, (*result)[0]);
+		iterate_steps (*this->input_data_, this->step_, this->history_, *result, gamma, local_solution_caller_ (this), accumulator);
+
+		return result;
+	}
+
+
+	//! Кидает std::logic_error, если алгоритму нужна история входных данных (см. set_parallel()).
+	void check_parallel_history_() {
+		if (this->get_history_capacity_())
+			throw std::logic_error ("Параллельный режим недоступен для алгоритмов, использующих историю входных данных.");
+	}
 
-		// выделяем память под входные данные на каждом текущем шаге
-		int steps_count = this->get_algorithm_steps_count_();
-		std::vector<I> gamma (steps_count);
 
+	/** Параллельная реализация execute() (см. set_parallel()).
+	 *
+	 * Шаги обрабатываются сегментами по segment_steps шагов:
+	 * - входные данные на сегменте запрашиваются последовательно (теми же
+	 *   блоками, что и в execute());
+	 * - решения на отрезках q[i] параллельно записываются прямо в result[i];
+	 * - сегмент делится на куски по числу потоков, и в каждом куске
+	 *   параллельно считаются префиксные произведения: в первом - сразу от
+	 *   ответа в конце предыдущего сегмента, в остальных - от единицы;
+	 * - последовательно (по числу кусков) находятся ответы на границах
+	 *   кусков, и они нормируются - это не даёт накапливаться погрешности
+	 *   длины;
+	 * - каждый кусок, кроме первого, параллельно умножается слева на ответ
+	 *   на границе перед ним.
+	 */
+	void execute_parallel_ (typename algorithm<Q,I>::t_output_data & result) {
+		check_parallel_history_();
+
+		int steps_count = this->get_algorithm_steps_count_();
 		long double step = this->step_;
 		long double delta_t = step / steps_count;
 
-		for (size_t i=1; i<result->get_count(); ++i) {
-			// вычисляем входные данные
-			long double t = result->ts[i];
-			for (int j=0; j<steps_count; ++j) {
-				long double t1 = t - step + j * delta_t,
-					t2 = t1 + delta_t;
-				gamma[j] = this->input_data_->get_integrated (t1, t2);
+		const size_t block_steps = 1024;
+		const size_t segment_steps = 64 * block_steps;
+		std::vector<I> increments, block_increments;
+
+#ifdef _OPENMP
+		int chunks = omp_get_max_threads();
+#else
+		int chunks = 1;
+#endif
+		std::vector<Q> boundaries (chunks);
+
+		for (size_t first=1; first<result.get_count(); first+=segment_steps) {
+			size_t last = std::min (first + segment_steps, result.get_count());
+
+			// входные данные на сегменте
+			increments.resize ((last - first) * steps_count);
+			for (size_t i=first; i<last; i+=block_steps) {
+				size_t block = std::min (block_steps, last - i);
+				this->input_data_->get_integrated_range (result.ts[i] - step, delta_t, block * steps_count, block_increments);
+				std::copy (block_increments.begin(), block_increments.end(), increments.begin() + (i - first) * steps_count);
 			}
 
-			// вычисляем решение на текущем временном отрезке
-			Q q = this->get_local_solution_ (t, gamma);
+			// решения на отрезках
+			long count = long (last - first);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+			{
+				std::vector<I> gamma (steps_count);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+				for (long k=0; k<count; ++k) {
+					std::copy (increments.begin() + k * steps_count, increments.begin() + (k + 1) * steps_count, gamma.begin());
+					result[first + k] = this->get_local_solution_ (result.ts[first + k], gamma);
+				}
+			}
 
-			// вычисляем новый ответ
-			(*result)[i] = (*result)[i-1] * q;
-		}
+			// префиксные произведения внутри кусков
+			long chunk_size = (count + chunks - 1) / chunks;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+			for (int c=0; c<chunks; ++c) {
+				long begin = std::min (count, c * chunk_size),
+					end = std::min (count, begin + chunk_size);
+				if (begin == end)
+					continue;
+				size_t i = first + begin;
+				if (c == 0)
+					result[i] = result[i-1] * result[i];
+				for (++i; i<first+end; ++i)
+					result[i] = result[i-1] * result[i];
+			}
 
-		return result;
+			// ответы на границах кусков
+			for (int c=1; c<chunks; ++c) {
+				long begin = std::min (count, c * chunk_size),
+					end = std::min (count, begin + chunk_size);
+				if (begin == end)
+					break;
+				Q previous = (c == 1) ? result[first + begin - 1] : boundaries[c-1] * result[first + begin - 1];
+				boundaries[c] = normalize (previous);
+			}
+
+			// домножение кусков на ответы на границах
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+			for (int c=1; c<chunks; ++c) {
+				long begin = std::min (count, c * chunk_size),
+					end = std::min (count, begin + chunk_size);
+				for (long k=begin; k<end; ++k)
+					result[first + k] = boundaries[c] * result[first + k];
+			}
+		}
 	}
 
 
@@ -0,0 +1,308 @@
+/** \file magnus_algorithm.hpp
+    \brief Содержит семейство алгоритмов "magnus_algorithm" - N-шаговые алгоритмы по разложению Магнуса (по интегральным входным данным).
+*/
+
+#pragma once
+#ifndef ALGORITHMS_MAGNUS_ALGORITHM_H
+#define ALGORITHMS_MAGNUS_ALGORITHM_H
+
+
+
+#include <boost/array.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <string>
+#include "iterative_algorithm.hpp"
+#include "iterative_riccati_algorithm.hpp"
+#include "stuff/magnus_coefficients.hpp"
+#include "stuff/rotation_functions.hpp"
+#include "../types/quaternion.hpp"
+#include "../types/vector3.hpp"
+
+
+
+/** Вычисляет вектор поворота за шаг по входным данным на N подотрезках последовательными приближениями, с точностью до членов порядка h^Order.
+ *
+ * Время шага нормируется на [-1; 1], скорость - это многочлен
+ * Omega(s) = sum_m omega[m] s^m (см. magnus_coefficients::velocity), где
+ * omega[m] - порядка h^(m+1) (omega[m] s^m - это член Тейлора скорости в
+ * центре шага, умноженной на h/2). Поэтому члены разложения удобно
+ * группировать не по числу сомножителей, а по степени h ("весу"): вес
+ * omega[m] - это m+1, вес произведения - сумма весов. Решение ищется в виде
+ * phi = sum_w phi[w], где phi[w](s) - многочлен степени не выше w из
+ * членов веса w, и phi[w](-1) = 0. Подстановка в уравнение Бортца
+ * phi' = Omega + 1/2 phi x Omega + f(|phi|^2) phi x (phi x Omega),
+ * f(x) = 1/12 + x/720 + x^2/30240 + x^3/1209600 + ...,
+ * и сбор членов веса w дают phi[w]' через phi[1..w-1]; интегрирование
+ * многочленов точное. Ответ - сумма phi[w](1) (члены первого порядка по
+ * входным данным в ней заменяются точной суммой gamma[i]).
+ *
+ * В отличие от magnus_tensor_rotation_vector(), коэффициенты при
+ * произведениях входных данных не выписываются, поэтому годится для любого
+ * порядка.
+ *
+ * @tparam Order Наибольшая степень h среди оставляемых членов (от 1 до 9).
+ * @param gamma Контейнер из N элементов - входных данных на текущем временном отрезке.
+ */
+template <int N, int Order, class Increments>
+typename Increments::value_type magnus_series_rotation_vector (const Increments & gamma) {
+	BOOST_STATIC_ASSERT_MSG( Order >= 1 && Order <= 9, "magnus_series_rotation_vector: коэффициенты f(x) заданы до порядка 9" );
+
+	typedef typename Increments::value_type t_vector;
+	typedef typename t_vector::value_type t_scalar;
+	const magnus_coefficients<N> & coefficients = magnus_coefficients<N>::get();
+
+	// f(x) = sum_p bortz[p] x^p; членам веса не больше Order нужны p <= powers
+	const int powers = (Order > 3) ? (Order - 3) / 2 : 0;
+	static const long double bortz[] = { 1.0L / 12, 1.0L / 720, 1.0L / 30240, 1.0L / 1209600 };
+
+	boost::array<t_vector, N> omega;
+	for (int m=0; m<N; ++m) {
+		omega[m] = gamma[0] * (t_scalar) coefficients.velocity[m * N];
+		for (int i=1; i<N; ++i)
+			omega[m] += gamma[i] * (t_scalar) coefficients.velocity[m * N + i];
+	}
+
+	// phi[w], cross[w] = (phi x Omega)[w], double_cross[w] = (phi x (phi x Omega))[w], norm[p][w] = (|phi|^(2p+2))[w];
+	// многочлены веса w имеют степень не больше w
+	boost::array < boost::array<t_vector, Order + 1>, Order + 1 > phi, cross, double_cross;
+	boost::array < boost::array < boost::array<t_scalar, Order + 1>, Order + 1 >, powers + 1 > norm;
+	for (int p=0; p<=powers; ++p)
+		for (int w=0; w<=Order; ++w)
+			norm[p][w].fill (0);
+
+	t_vector result = gamma[0];
+	for (int i=1; i<N; ++i)
+		result += gamma[i];
+
+	for (int w=1; w<=Order; ++w) {
+		// (phi x Omega)[w] = sum phi[w-v] x omega[v-1] s^(v-1)
+		for (int v=1; v<=N && v<w; ++v)
+			for (int d=0; d<=w-v; ++d)
+				cross[w][d + v - 1] += crossProduct (phi[w-v][d], omega[v-1]);
+
+		// (phi x (phi x Omega))[w] = sum phi[u] x cross[w-u]
+		for (int u=1; u+2<=w; ++u)
+			for (int d=0; d<=u; ++d)
+				for (int e=0; e<w-u; ++e)
+					double_cross[w][d + e] += crossProduct (phi[u][d], cross[w-u][e]);
+
+		// (|phi|^2)[w] и её степени - они умножаются на double_cross веса не меньше 3
+		if (w + 3 <= Order) {
+			for (int u=1; u<w; ++u)
+				for (int d=0; d<=u; ++d)
+					for (int e=0; e<=w-u; ++e)
+						norm[0][w][d + e] += dotProduct (phi[u][d], phi[w-u][e]);
+			for (int p=1; p<powers; ++p)
+				for (int u=2; u+2*p<=w; ++u)
+					for (int d=0; d<=u; ++d)
+						for (int e=0; e<=w-u; ++e)
+							norm[p][w][d + e] += norm[0][u][d] * norm[p-1][w-u][e];
+		}
+
+		// нелинейная часть phi[w]': 1/2 cross[w] + sum_p bortz[p] (|phi|^(2p) double_cross)[w]
+		boost::array<t_vector, Order + 1> rate;
+		for (int d=0; d<w; ++d)
+			rate[d] = cross[w][d] / 2 + double_cross[w][d] * (t_scalar) bortz[0];
+		for (int p=1; p<=powers; ++p)
+			for (int u=2*p; u+3<=w; ++u)
+				for (int d=0; d<=u; ++d)
+					for (int e=0; e<w-u; ++e)
+						rate[d + e] += double_cross[w-u][e] * (norm[p-1][u][d] * (t_scalar) bortz[p]);
+
+		// интеграл нелинейной части по [-1; 1]: сумма 2 rate[d] / (d+1) по чётным d
+		for (int d=0; d<w; d+=2)
+			result += rate[d] * (2 / (t_scalar) (d + 1));
+
+		// линейная часть - omega[w-1] s^(w-1) - в ответе уже учтена суммой gamma[i]
+		if (w <= N)
+			rate[w - 1] += omega[w - 1];
+
+		// phi[w](s) - интеграл rate от -1 до s
+		for (int d=0; d<w; ++d) {
+			phi[w][d + 1] = rate[d] / (t_scalar) (d + 1);
+			if (d % 2 == 0)
+				phi[w][0] += phi[w][d + 1];
+			else
+				phi[w][0] -= phi[w][d + 1];
+		}
+	}
+
+	return result;
+}
+
+
+
+/** Вычисляет вектор поворота за шаг по входным данным на N подотрезках с точностью до членов четвёртого порядка - по тензорам коэффициентов (см. magnus_coefficients).
+ *
+ * @param gamma Контейнер из N элементов - входных данных на текущем временном отрезке.
+ */
+template <int N, class Increments>
+typename Increments::value_type magnus_tensor_rotation_vector (const Increments & gamma) {
+	typedef typename Increments::value_type t_vector;
+	typedef typename t_vector::value_type t_scalar;
+	typedef magnus_coefficients<N> t_coefficients;
+	const t_coefficients & coefficients = t_coefficients::get();
+	const int pairs_count = t_coefficients::pairs_count;
+
+	// попарные векторные произведения c[jk] = gamma[j] x gamma[k], j<k
+	boost::array < t_vector, pairs_count + 1 > crosses;
+	for (int j=0; j<N; ++j)
+		for (int k=j+1; k<N; ++k)
+			crosses[t_coefficients::pair_index (j, k)] = crossProduct (gamma[j], gamma[k]);
+
+	t_vector phi = gamma[0];
+	for (int j=1; j<N; ++j)
+		phi += gamma[j];
+
+	for (int jk=0; jk<pairs_count; ++jk) {
+		// второй и третий порядки
+		t_vector u = gamma[0] * (t_scalar) coefficients.third[jk * N];
+		for (int i=1; i<N; ++i)
+			u += gamma[i] * (t_scalar) coefficients.third[jk * N + i];
+		phi += (t_scalar) coefficients.second[jk] * crosses[jk] + crossProduct (u, crosses[jk]);
+
+		// четвёртый порядок, первый вид
+		for (int b=0; b<N; ++b) {
+			const long double * c = &coefficients.fourth_a[(b * pairs_count + jk) * N];
+			t_vector v = gamma[0] * (t_scalar) c[0];
+			for (int a=1; a<N; ++a)
+				v += gamma[a] * (t_scalar) c[a];
+			phi += crossProduct (v, crossProduct (gamma[b], crosses[jk]));
+		}
+
+		// четвёртый порядок, второй вид
+		if (jk + 1 < pairs_count) {
+			const long double * c = &coefficients.fourth_b[jk * pairs_count];
+			t_vector w = crosses[jk + 1] * (t_scalar) c[jk + 1];
+			for (int lm=jk+2; lm<pairs_count; ++lm)
+				w += crosses[lm] * (t_scalar) c[lm];
+			phi += crossProduct (crosses[jk], w);
+		}
+	}
+
+	return phi;
+}
+
+
+
+/** Вычисляет вектор поворота за шаг по входным данным на N подотрезках (см. magnus_coefficients).
+ *
+ * Общая часть алгоритмов magnus_algorithm и magnus_riccati_algorithm. При
+ * N<=3 используются тензоры коэффициентов (magnus_tensor_rotation_vector()),
+ * при N>=4 - последовательные приближения с членами до h^(N+2) или h^(N+3)
+ * включительно, смотря какая из степеней нечётна
+ * (magnus_series_rotation_vector()). Члены с чётными степенями h в
+ * разложении относительно центра шага взаимно уничтожаются, и с таким
+ * запасом погрешность определяется приближением скорости многочленом, а не
+ * обрезанием ряда.
+ *
+ * @param gamma Контейнер из N элементов - входных данных на текущем временном отрезке.
+ */
+template <int N, class Increments>
+typename Increments::value_type magnus_rotation_vector (const Increments & gamma) {
+	if (N >= 4)
+		return magnus_series_rotation_vector<N, N + 3 - N % 2> (gamma);
+	return magnus_tensor_rotation_vector<N> (gamma);
+}
+
+
+
+/** Класс "magnus_algorithm" - N-шаговый алгоритм по разложению Магнуса (по интегральным входным данным).
+ *
+ * Вектор поворота за шаг вычисляется по входным данным на N подотрезках
+ * (см. magnus_rotation_vector()), а решение на шаге - это соответствующий
+ * ему кватернион. Коэффициенты разложения выводятся автоматически (см.
+ * magnus_coefficients), так что шаговость можно выбирать, не выводя каждый
+ * вариант вручную.
+ *
+ * @tparam N Шаговость алгоритма (от 1 до 6, см. magnus_coefficients).
+ * @tparam T Скалярный тип кватернионов и входных данных (см. basic_quaternion).
+ */
+template <int N, typename T = long double>
+class magnus_algorithm : public iterative_algorithm< basic_quaternion<T>, basic_vector3<T> > {
+
+public:
+
+
+	magnus_algorithm() {
+		magnus_coefficients<N>::get();
+	}
+
+
+private:
+
+
+	//! Возвращает название алгоритма в виде строки.
+	virtual std::string get_algorithm_title() {
+		return "Алгоритм по разложению Магнуса (" + boost::lexical_cast<std::string> (N) + "-шаговый, по интегральным данным)";
+	}
+
+
+	//! Возвращает "Шаговость" алгоритма.
+	virtual int get_algorithm_steps_count_() {
+		return N;
+	}
+
+
+	/** Вычисляет решение на текущем временном отрезке.
+	 *
+	 * @param t Время, в которое требуется найти решение.
+	 * @param gamma Вектор, состоящий из N элементов - входных данных на текущем временном отрезке.
+	 */
+	virtual basic_quaternion<T> get_local_solution_ (long double /* t */, const std::vector< basic_vector3<T> > & gamma) {
+		return rotation_quaternion< basic_quaternion<T> > (magnus_rotation_vector<N> (gamma));
+	}
+
+
+}; // class magnus_algorithm
+
+
+
+/** Класс "magnus_riccati_algorithm" - N-шаговый алгоритм по разложению Магнуса, модифицированный под уравнения типа Риккати.
+ *
+ * @tparam N Шаговость алгоритма (от 1 до 6, см. magnus_coefficients).
+ * @tparam T Скалярный тип кватернионов и входных данных (см. basic_quaternion).
+ */
+template <int N, typename T = long double>
+class magnus_riccati_algorithm : public iterative_riccati_algorithm< basic_quaternion<T>, basic_vector3<T> > {
+
+public:
+
+
+	magnus_riccati_algorithm() {
+		magnus_coefficients<N>::get();
+	}
+
+
+private:
+
+
+	//! Возвращает название алгоритма в виде строки.
+	virtual std::string get_algorithm_title() {
+		return "Алгоритм по разложению Магнуса, модифицированный под уравнения типа Риккати (" + boost::lexical_cast<std::string> (N) + "-шаговый, по интегральным данным)";
+	}
+
+
+	//! Возвращает "Шаговость" алгоритма.
+	virtual int get_algorithm_steps_count_() {
+		return N;
+	}
+
+
+	/** Вычисляет решение x по типу Риккати на текущем временном отрезке.
+	 *
+	 * @param t Время, в которое требуется найти решение.
+	 * @param gamma Вектор, состоящий из N элементов - входных данных на текущем временном отрезке.
+	 */
+	virtual basic_quaternion<T> get_local_riccati_solution_ (long double /* t */, const std::vector< basic_vector3<T> > & gamma) {
+		return rotation_riccati_solution< basic_quaternion<T> > (magnus_rotation_vector<N> (gamma));
+	}
+
+
+}; // class magnus_riccati_algorithm
+
+
+
+#endif // ifndef ALGORITHMS_MAGNUS_ALGORITHM_H
@@ -11,6 +11,19 @@
 #include <boost/typeof/typeof.hpp>
 #include <cmath>
 #include "../iterative_algorithm.hpp"
+#include "../static_iterative_algorithm.hpp"
+#include "../stuff/rotation_functions.hpp"
+
+
+
+/** Вычисляет решение на текущем временном отрезке по методу средней скорости.
+ *
+ * @param phi Входные данные на текущем временном отрезке.
+ */
+template <typename Q, typename I>
+Q average_speed_local_solution (const I & phi) {
+	return rotation_quaternion<Q> (phi);
+}
 
 
 
@@ -36,14 +49,8 @@ private:
 	 * @param t Время, в которое требуется найти решение.
 	 * @param gamma Вектор, состоящий из единственного элемента - входных данных на текущем временном отрезке.
 	 */
-	virtual Q get_local_solution_ (long double t, const std::vector<I> & gamma) {
-		const I & phi = gamma[0];
-		BOOST_AUTO( phi_m, phi.length() );
-
-		return Q (
-			cos (phi_m / 2),
-			phi * sin (phi_m / 2) / phi_m
-		);
+	virtual Q get_local_solution_ (long double /* t */, const std::vector<I> & gamma) {
+		return average_speed_local_solution<Q> (gamma[0]);
 	}
 
 
@@ -51,4 +58,34 @@ private:
 
 
 
+/** Класс "static_average_speed_algorithm" - метод средней скорости (см. average_speed_algorithm), реализованный через static_iterative_algorithm.
+ *
+ * @tparam Q Выбранная алгебра (кватернионы/бикватернионы).
+ * @tparam I Выбранный тип входных данных.
+ */
+template <typename Q, typename I>
+class static_average_speed_algorithm : public static_iterative_algorithm<static_average_speed_algorithm<Q,I>,Q,I,1> {
+
+private:
+
+
+	friend class static_iterative_algorithm<static_average_speed_algorithm<Q,I>,Q,I,1>;
+
+
+	//! Возвращает название алгоритма в виде строки.
+	virtual std::string get_algorithm_title() {
+		return "Метод средней скорости (1-шаговый, 2-го порядка, по интегральным данным, статический)";
+	}
+
+
+	//! Вычисляет решение на текущем временном отрезке (см. average_speed_algorithm::get_local_solution_()).
+	Q get_local_solution_ (long double /* t */, const typename static_average_speed_algorithm::t_increments & gamma) {
+		return average_speed_local_solution<Q> (gamma[0]);
+	}
+
+
+}; // class static_average_speed_algorithm
+
+
+
 #endif // ifndef ALGORITHMS_OLD_ALGORITHMS_AVERAGE_SPEED_ALGORITHM_H
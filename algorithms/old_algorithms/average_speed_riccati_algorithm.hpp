@@ -11,6 +11,7 @@
 #include <boost/typeof/typeof.hpp>
 #include <cmath>
 #include "../iterative_riccati_algorithm.hpp"
+#include "../stuff/rotation_functions.hpp"
 
 
 
@@ -36,11 +37,8 @@ private:
 	 * @param t Время, в которое требуется найти решение.
 	 * @param gamma Вектор, состоящий из единственного элемента - входных данных на текущем временном отрезке.
 	 */
-	virtual Q get_local_riccati_solution_ (long double t, const std::vector<I> & gamma) {
-		const I & phi = gamma[0];
-		BOOST_AUTO( phi_m, phi.length() );
-
-		return phi / phi_m * tan (phi_m / 4);
+	virtual Q get_local_riccati_solution_ (long double /* t */, const std::vector<I> & gamma) {
+		return rotation_riccati_solution<Q> (gamma[0]);
 	}
 
 
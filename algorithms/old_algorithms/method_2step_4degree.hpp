@@ -10,11 +10,29 @@
 
 #include <cmath>
 #include "../iterative_algorithm.hpp"
+#include "../static_iterative_algorithm.hpp"
 #include "../../types/quaternion.hpp"
 #include "../../types/vector3.hpp"
 
 
 
+/** Вычисляет решение на текущем временном отрезке по алгоритму method_2step_4degree.
+ *
+ * @param gamma Контейнер из двух элементов - входных данных на текущем временном отрезке.
+ */
+template <class Increments>
+quaternion method_2step_4degree_local_solution (const Increments & gamma) {
+	vector3 gamma_s = gamma[0] + gamma[1];
+	long double gamma_s_SQ = gamma_s.norm();
+
+	return quaternion (
+		1 - gamma_s_SQ / 8,
+		(0.5 - gamma_s_SQ / 48) * (gamma_s + crossProduct (gamma[0], gamma[1]) * 2 / 3)
+	);
+}
+
+
+
 /** Класс "method_2step_4degree" - численный алгоритм (2-шаговый, 4-го порядка точности, по интегральным входным данным).
  */
 class method_2step_4degree : public iterative_algorithm<quaternion,vector3> {
@@ -43,14 +61,8 @@ private:
 	 * @param t Время, в которое требуется найти решение.
 	 * @param gamma Вектор, состоящий из двух элементов - входных данных на текущем временном отрезке.
 	 */
-	virtual quaternion get_local_solution_ (long double t, const std::vector<vector3> & gamma) {
-		vector3 gamma_s = gamma[0] + gamma[1];
-		long double gamma_s_SQ = gamma_s.norm();
-
-		return quaternion (
-			1 - gamma_s_SQ / 8,
-			(0.5 - gamma_s_SQ / 48) * (gamma_s + crossProduct (gamma[0], gamma[1]) * 2 / 3)
-		);
+	virtual quaternion get_local_solution_ (long double /* t */, const std::vector<vector3> & gamma) {
+		return method_2step_4degree_local_solution (gamma);
 	}
 
 
@@ -58,4 +70,30 @@ private:
 
 
 
+/** Класс "static_method_2step_4degree" - алгоритм method_2step_4degree, реализованный через static_iterative_algorithm.
+ */
+class static_method_2step_4degree : public static_iterative_algorithm<static_method_2step_4degree,quaternion,vector3,2> {
+
+private:
+
+
+	friend class static_iterative_algorithm<static_method_2step_4degree,quaternion,vector3,2>;
+
+
+	//! Возвращает название алгоритма в виде строки.
+	virtual std::string get_algorithm_title() {
+		return "Алгоритм (2-шаговый, 4-го порядка, по интегральным данным, статический)";
+	}
+
+
+	//! Вычисляет решение на текущем временном отрезке (см. method_2step_4degree::get_local_solution_()).
+	quaternion get_local_solution_ (long double /* t */, const t_increments & gamma) {
+		return method_2step_4degree_local_solution (gamma);
+	}
+
+
+}; // class static_method_2step_4degree
+
+
+
 #endif // ifndef ALGORITHMS_OLD_ALGORITHMS_METHOD_2_STEP_4_DEGREE_H
@@ -45,7 +45,7 @@ private:
 	 * @param t Время, в которое требуется найти решение.
 	 * @param gamma Вектор, состоящий из двух элементов - входных данных на текущем временном отрезке.
 	 */
-	virtual quaternion get_local_riccati_solution_ (long double t, const std::vector<vector3> & gamma) {
+	virtual quaternion get_local_riccati_solution_ (long double /* t */, const std::vector<vector3> & gamma) {
 		quaternion q0 = gamma[0];
 		quaternion q1 = gamma[1];
 
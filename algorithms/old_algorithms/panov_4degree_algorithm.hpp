@@ -10,8 +10,9 @@
 
 #include <cmath>
 #include "../iterative_algorithm.hpp"
+#include "../stuff/rotation_functions.hpp"
 #include "../../types/quaternion.hpp"
-#include "../../types/matrix33.hpp"
+#include "../../types/skew33.hpp"
 #include "../../types/vector3.hpp"
 
 
@@ -46,16 +47,10 @@ private:
 	 * @param t Время, в которое требуется найти решение.
 	 * @param gamma Вектор, состоящий из четырёх элементов - входных данных на текущем временном отрезке.
 	 */
-	virtual quaternion get_local_solution_ (long double t, const std::vector<vector3> & gamma) {
-		matrix33 Gamma[4];
-		for (int j=0; j<4; ++j) {
-			const vector3 & g = gamma[j];
-			Gamma[j] = matrix33 (
-				    0,   -g[2],    g[1],
-				 g[2],       0,   -g[0],
-				-g[1],    g[0],       0
-			);
-		}
+	virtual quaternion get_local_solution_ (long double /* t */, const std::vector<vector3> & gamma) {
+		skew33 Gamma[4];
+		for (int j=0; j<4; ++j)
+			Gamma[j] = skew33 (gamma[j]);
 
 		
 		vector3 phi =
@@ -66,11 +61,7 @@ private:
 		for (int j=0; j<4; ++j)
 			phi += gamma[j];
 
-		long double phi_m = phi.length();
-		return quaternion (
-			cos (phi_m / 2),
-			phi * sin (phi_m / 2) / phi_m
-		);
+		return rotation_quaternion<quaternion> (phi);
 	}
 
 
@@ -10,15 +10,56 @@
 
 #include <cmath>
 #include "../iterative_algorithm.hpp"
+#include "../static_iterative_algorithm.hpp"
+#include "../stuff/rotation_functions.hpp"
 #include "../../types/quaternion.hpp"
-#include "../../types/matrix33.hpp"
+#include "../../types/skew33.hpp"
 #include "../../types/vector3.hpp"
 
 
 
-/** Класс "panov_algorithm" - алгоритм Панова (4-шаговый, 6-го порядка точности, по интегральным входным данным).
+/** Вычисляет вектор поворота по алгоритму Панова.
+ *
+ * Общая часть алгоритмов panov_algorithm, panov_riccati_algorithm и их
+ * статических аналогов. Вычисления ведутся в том же скалярном типе, что и
+ * входные данные (см. basic_vector3).
+ *
+ * @param gamma Контейнер из четырёх элементов - входных данных на текущем временном отрезке.
  */
-class panov_algorithm : public iterative_algorithm<quaternion,vector3> {
+template <class Increments>
+typename Increments::value_type panov_rotation_vector (const Increments & gamma) {
+	typedef typename Increments::value_type t_vector;
+	typedef basic_skew33<typename t_vector::value_type> t_skew;
+
+	t_skew Gamma[4];
+	for (int j=0; j<4; ++j)
+		Gamma[j] = t_skew (gamma[j]);
+
+	
+	t_vector phi =
+		22.0/45 * (Gamma[0] + Gamma[1]) * (gamma[2] + gamma[3]) +
+		32.0/45 * (Gamma[0] * gamma[1] + Gamma[2] * gamma[3]);
+
+	t_vector delta_phi =
+		32.0/45 * (Gamma[0]*Gamma[1]*gamma[3] - Gamma[3]*Gamma[0]*gamma[2]) +
+		64.0/45 * dotProduct (gamma[1], gamma[2]) * Gamma[1] * gamma[2];
+
+		
+	for (int j=0; j<4; ++j)
+		phi += gamma[j];
+	phi += delta_phi;
+
+	return phi;
+}
+
+
+
+/** Класс "basic_panov_algorithm" - алгоритм Панова (4-шаговый, 6-го порядка точности, по интегральным входным данным).
+ *
+ * @tparam T Скалярный тип кватернионов и входных данных (см. basic_quaternion).
+ */
+template <typename T>
+class basic_panov_algorithm : public iterative_algorithm< basic_quaternion<T>, basic_vector3<T> > {
 
 private:
 	
@@ -44,40 +85,43 @@ private:
 	 * @param t Время, в которое требуется найти решение.
 	 * @param gamma Вектор, состоящий из четырёх элементов - входных данных на текущем временном отрезке.
 	 */
-	virtual quaternion get_local_solution_ (long double t, const std::vector<vector3> & gamma) {
-		matrix33 Gamma[4];
-		for (int j=0; j<4; ++j) {
-			const vector3 & g = gamma[j];
-			Gamma[j] = matrix33 (
-				    0,   -g[2],    g[1],
-				 g[2],       0,   -g[0],
-				-g[1],    g[0],       0
-			);
-		}
+	virtual basic_quaternion<T> get_local_solution_ (long double /* t */, const std::vector< basic_vector3<T> > & gamma) {
+		return rotation_quaternion< basic_quaternion<T> > (panov_rotation_vector (gamma));
+	}
 
-		
-		vector3 phi =
-			22.0/45 * (Gamma[0] + Gamma[1]) * (gamma[2] + gamma[3]) +
-			32.0/45 * (Gamma[0] * gamma[1] + Gamma[2] * gamma[3]);
-
-		vector3 delta_phi =
-			32.0/45 * (Gamma[0]*Gamma[1]*gamma[3] - Gamma[3]*Gamma[0]*gamma[2]) +
-			64.0/45 * dotProduct (gamma[1], gamma[2]) * Gamma[1] * gamma[2];
-
-			
-		for (int j=0; j<4; ++j)
-			phi += gamma[j];
-		phi += delta_phi;
-
-		long double phi_m = phi.length();
-		return quaternion (
-			cos (phi_m / 2),
-			phi * sin (phi_m / 2) / phi_m
-		);
+
+}; // class basic_panov_algorithm
+
+
+
+//! Алгоритм Панова над кватернионами с компонентами типа long double.
+typedef basic_panov_algorithm<long double> panov_algorithm;
+
+
+
+/** Класс "static_panov_algorithm" - алгоритм Панова (см. panov_algorithm), реализованный через static_iterative_algorithm.
+ */
+class static_panov_algorithm : public static_iterative_algorithm<static_panov_algorithm,quaternion,vector3,4> {
+
+private:
+
+
+	friend class static_iterative_algorithm<static_panov_algorithm,quaternion,vector3,4>;
+
+
+	//! Возвращает название алгоритма в виде строки.
+	virtual std::string get_algorithm_title() {
+		return "Алгоритм Панова (4-шаговый, 6-го порядка, по интегральным данным, статический)";
+	}
+
+
+	//! Вычисляет решение на текущем временном отрезке (см. panov_algorithm::get_local_solution_()).
+	quaternion get_local_solution_ (long double /* t */, const t_increments & gamma) {
+		return rotation_quaternion<quaternion> (panov_rotation_vector (gamma));
 	}
 
 
-}; // class panov_algorithm
+}; // class static_panov_algorithm
 
 
 
@@ -10,15 +10,20 @@
 
 #include <cmath>
 #include "../iterative_riccati_algorithm.hpp"
+#include "../static_iterative_algorithm.hpp"
+#include "../stuff/rotation_functions.hpp"
 #include "../../types/quaternion.hpp"
-#include "../../types/matrix33.hpp"
 #include "../../types/vector3.hpp"
+#include "panov_algorithm.hpp"
 
 
 
-/** Класс "panov_riccati_algorithm" - алгоритм Панова, модифицированный под уравнения типа Риккати (4-шаговый, 6-го порядка точности, по интегральным входным данным).
+/** Класс "basic_panov_riccati_algorithm" - алгоритм Панова, модифицированный под уравнения типа Риккати (4-шаговый, 6-го порядка точности, по интегральным входным данным).
+ *
+ * @tparam T Скалярный тип кватернионов и входных данных (см. basic_quaternion).
  */
-class panov_riccati_algorithm : public iterative_riccati_algorithm<quaternion,vector3> {
+template <typename T>
+class basic_panov_riccati_algorithm : public iterative_riccati_algorithm< basic_quaternion<T>, basic_vector3<T> > {
 
 private:
 	
@@ -44,37 +49,43 @@ private:
 	 * @param t Время, в которое требуется найти решение.
 	 * @param gamma Вектор, состоящий из четырёх элементов - входных данных на текущем временном отрезке.
 	 */
-	virtual quaternion get_local_riccati_solution_ (long double t, const std::vector<vector3> & gamma) {
-		matrix33 Gamma[4];
-		for (int j=0; j<4; ++j) {
-			const vector3 & g = gamma[j];
-			Gamma[j] = matrix33 (
-				    0,   -g[2],    g[1],
-				 g[2],       0,   -g[0],
-				-g[1],    g[0],       0
-			);
-		}
-
-		vector3 phi =
-			22.0/45 * (Gamma[0] + Gamma[1]) * (gamma[2] + gamma[3]) +
-			32.0/45 * (Gamma[0] * gamma[1] + Gamma[2] * gamma[3]);
-
-		vector3 delta_phi =
-			32.0/45 * (Gamma[0]*Gamma[1]*gamma[3] - Gamma[3]*Gamma[0]*gamma[2]) +
-			64.0/45 * dotProduct (gamma[1], gamma[2]) * Gamma[1] * gamma[2];
-
-			
-		for (int j=0; j<4; ++j)
-			phi += gamma[j];
-		phi += delta_phi;
-
-
-		long double phi_m = phi.length();
-		return quaternion (phi) / phi_m * tan (phi_m / 4);
+	virtual basic_quaternion<T> get_local_riccati_solution_ (long double /* t */, const std::vector< basic_vector3<T> > & gamma) {
+		return rotation_riccati_solution< basic_quaternion<T> > (panov_rotation_vector (gamma));
 	}
 
 
-}; // class panov_riccati_algorithm
+}; // class basic_panov_riccati_algorithm
+
+
+
+//! Алгоритм Панова типа Риккати над кватернионами с компонентами типа long double.
+typedef basic_panov_riccati_algorithm<long double> panov_riccati_algorithm;
+
+
+
+/** Класс "static_panov_riccati_algorithm" - алгоритм Панова типа Риккати (см. panov_riccati_algorithm), реализованный через static_iterative_algorithm.
+ */
+class static_panov_riccati_algorithm : public static_iterative_algorithm<static_panov_riccati_algorithm,quaternion,vector3,4> {
+
+private:
+
+
+	friend class static_iterative_algorithm<static_panov_riccati_algorithm,quaternion,vector3,4>;
+
+
+	//! Возвращает название алгоритма в виде строки.
+	virtual std::string get_algorithm_title() {
+		return "Алгоритм Панова, модифицированный под уравнения типа Риккати (4-шаговый, 6-го порядка, по интегральным данным, статический)";
+	}
+
+
+	//! Вычисляет решение на текущем временном отрезке (см. panov_riccati_algorithm::get_local_riccati_solution_()).
+	quaternion get_local_solution_ (long double /* t */, const t_increments & gamma) {
+		return from_riccati_ (rotation_riccati_solution<quaternion> (panov_rotation_vector (gamma)));
+	}
+
+
+}; // class static_panov_riccati_algorithm
 
 
 
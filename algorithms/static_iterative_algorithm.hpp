@@ -0,0 +1,117 @@
+/** \file static_iterative_algorithm.hpp
+    \brief Содержит шаблонный класс "статический итеративный алгоритм" -
+	аналог класса iterative_algorithm, в котором шаговость известна на этапе
+	компиляции, а решение на текущем шаге вычисляется без виртуальных вызовов.
+*/
+
+#pragma once
+#ifndef ALGORITHMS_STATIC_ITERATIVE_ALGORITHM_H
+#define ALGORITHMS_STATIC_ITERATIVE_ALGORITHM_H
+
+
+
+#include <boost/array.hpp>
+#include <boost/typeof/typeof.hpp>
+#include "algorithm.hpp"
+#include "stuff/iterate_steps.hpp"
+#include "stuff/solution_accumulator.hpp"
+
+
+
+/** Класс "статический итеративный алгоритм".
+ *
+ * Делает то же, что и iterative_algorithm, но:
+ * - шаговость алгоритма (см. iterative_algorithm::get_algorithm_steps_count_())
+ *   задаётся параметром шаблона Steps;
+ * - входные данные на текущем шаге передаются в boost::array фиксированного
+ *   размера, а не в std::vector;
+ * - решение на текущем шаге вычисляется невиртуальным методом
+ *   get_local_solution_() класса-потомка Derived (по схеме CRTP), так что
+ *   компилятор может встроить его в цикл метода execute().
+ *
+ * Класс-потомок должен определить метод
+ * Q get_local_solution_ (long double t, const t_increments & gamma)
+ * (и открыть к нему доступ данному классу). Для алгоритмов типа Риккати
+ * (см. iterative_riccati_algorithm) решение x переводится в искомый
+ * (би)кватернион методом from_riccati_().
+ *
+ * Снаружи это обычный алгоритм (см. класс algorithm), так что его можно
+ * тестировать в math_modelling наравне с остальными.
+ *
+ * @tparam Derived Класс-потомок.
+ * @tparam Q Выбранная алгебра (кватернионы/бикватернионы).
+ * @tparam I Выбранный тип входных данных.
+ * @tparam Steps Шаговость алгоритма.
+ */
+template <class Derived, typename Q, typename I, int Steps>
+class static_iterative_algorithm : public algorithm<Q,I> {
+
+public:
+
+
+	//! Сокращение для типа входных данных на текущем шаге.
+	typedef boost::array<I,Steps> t_increments;
+
+
+	virtual ~static_iterative_algorithm() {
+	}
+
+
+	/** Запускает алгоритм, возвращая полученные результаты работы.
+	 *
+	 * Цикл по шагам - тот же, что и в iterative_algorithm::execute() (см.
+	 * iterate_steps()): входные данные запрашиваются блоками и складываются в
+	 * историю (см. algorithm::history_), если у неё ненулевая ёмкость, а
+	 * ответ накапливается в той же алгебре (native_accumulation).
+	 *
+	 * Память под блок входных данных выделяется один раз, до начала цикла,
+	 * так что число выделений памяти не зависит от длины расчёта.
+	 */
+	virtual typename algorithm<Q,I>::t_output_data_ptr execute() {
+		typename algorithm<Q,I>::t_output_data_ptr result = this->init_output_data_();
+		t_increments gamma;
+		solution_accumulator<Q> accumulator (native_accumulation, (*result)[0]);
+		iterate_steps (*this->input_data_, this->step_, this->history_, *result, gamma, local_solution_caller_ (static_cast<Derived *> (this)), accumulator);
+		return result;
+	}
+
+
+protected:
+
+
+	//! Отрезки истории - подотрезки шага (длины step/Steps), см. algorithm::get_history_interval_().
+	virtual long double get_history_interval_() {
+		return this->step_ / Steps;
+	}
+
+
+private:
+
+
+	//! Функтор, вызывающий невиртуальный метод get_local_solution_() класса-потомка (см. iterate_steps()).
+	struct local_solution_caller_ {
+		explicit local_solution_caller_ (Derived * derived)
+			: derived(derived)
+		{ }
+		Q operator() (long double t, const t_increments & gamma) const {
+			return derived->get_local_solution_ (t, gamma);
+		}
+		Derived * derived;
+	};
+
+
+protected:
+
+
+	//! Переводит решение x по типу Риккати в (би)кватернион - так же, как iterative_riccati_algorithm.
+	static Q from_riccati_ (const Q & x) {
+		BOOST_AUTO( norm, x.norm() );
+		return (Q(1) - Q(norm) + 2*x) / (1 + norm);
+	}
+
+
+}; // class static_iterative_algorithm
+
+
+
+#endif // ifndef ALGORITHMS_STATIC_ITERATIVE_ALGORITHM_H
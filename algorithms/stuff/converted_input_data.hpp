@@ -0,0 +1,82 @@
+/** \file converted_input_data.hpp
+    \brief Содержит класс "converted_input_data" - источник входных данных, переводящий данные другого источника в другой скалярный тип.
+*/
+
+#pragma once
+#ifndef ALGORITHMS_STUFF_CONVERTED_INPUT_DATA_H
+#define ALGORITHMS_STUFF_CONVERTED_INPUT_DATA_H
+
+
+
+#include <boost/shared_ptr.hpp>
+#include <vector>
+#include "input_data.hpp"
+
+
+
+/** Класс "converted_input_data" - источник входных данных, переводящий данные другого источника в другой скалярный тип.
+ *
+ * Позволяет запускать алгоритм, скажем, над кватернионами с компонентами
+ * типа double на входных данных, посчитанных в long double (см.
+ * basic_quaternion, basic_vector3). Преобразование выполняется явными
+ * конструкторами Q(SQ) и I(SI).
+ *
+ * @tparam Q Алгебра, в которой работает алгоритм.
+ * @tparam I Тип входных данных, с которыми работает алгоритм.
+ * @tparam SQ Алгебра исходного источника.
+ * @tparam SI Тип входных данных исходного источника.
+ */
+template <typename Q, typename I, typename SQ, typename SI>
+class converted_input_data : public input_data<Q,I> {
+
+public:
+
+
+	//! Сокращение для указателя на исходный источник.
+	typedef boost::shared_ptr < input_data<SQ,SI> > t_source_ptr;
+
+
+	explicit converted_input_data (const t_source_ptr & source)
+		: source_ (source)
+	{ }
+
+
+	virtual Q get_initial_solution() {
+		return Q (source_->get_initial_solution());
+	}
+
+	virtual I get_instanteous (long double t) {
+		return I (source_->get_instanteous (t));
+	}
+
+	virtual I get_integrated (long double t1, long double t2) {
+		return I (source_->get_integrated (t1, t2));
+	}
+
+	virtual void get_integrated_range (long double t0, long double step, size_t count, std::vector<I> & result) {
+		source_->get_integrated_range (t0, step, count, buffer_);
+		result.resize (count);
+		for (size_t k=0; k<count; ++k)
+			result[k] = I (buffer_[k]);
+	}
+
+	//! Возвращает счётчики исходного источника.
+	virtual input_data_counters get_counters() const {
+		return source_->get_counters();
+	}
+
+
+private:
+
+
+	//! Исходный источник.
+	t_source_ptr source_;
+	//! Буфер для данных исходного источника (см. get_integrated_range()).
+	std::vector<SI> buffer_;
+
+
+}; // class converted_input_data
+
+
+
+#endif // ifndef ALGORITHMS_STUFF_CONVERTED_INPUT_DATA_H
@@ -0,0 +1,110 @@
+/** \file increments_history.hpp
+    \brief Содержит класс "increments_history" - история последних входных данных алгоритма (см. класс algorithm).
+*/
+
+#pragma once
+#ifndef ALGORITHMS_STUFF_INCREMENTS_HISTORY_H
+#define ALGORITHMS_STUFF_INCREMENTS_HISTORY_H
+
+
+
+#include <stdexcept>
+#include <vector>
+
+
+
+/** Класс "increments_history" - история последних входных данных алгоритма (см. класс algorithm).
+ *
+ * Хранит входные данные на нескольких последних подряд идущих отрезках
+ * (кольцевой буфер фиксированной ёмкости). Отрезки нумеруются по порядку,
+ * начиная с единицы; при добавлении очередного отрезка самый старый
+ * вытесняется.
+ *
+ * Многошаговые алгоритмы, которым нужны входные данные на предыдущих
+ * отрезках, берут их отсюда, а не запрашивают у источника повторно.
+ *
+ * @tparam I Выбранный тип входных данных.
+ */
+template <typename I>
+class increments_history {
+
+public:
+
+
+	//! Конструктор истории заданной ёмкости.
+	explicit increments_history (size_t capacity = 0)
+		: values_ (capacity),
+		  count_ (0),
+		  next_index_ (1)
+	{ }
+
+
+	//! Очищает историю и задаёт новую ёмкость.
+	void reset (size_t capacity) {
+		values_.assign (capacity, I());
+		count_ = 0;
+		next_index_ = 1;
+	}
+
+	//! Возвращает ёмкость истории.
+	size_t get_capacity() const {
+		return values_.size();
+	}
+
+	//! Возвращает число отрезков, хранящихся в истории.
+	size_t get_count() const {
+		return count_;
+	}
+
+	//! Возвращает номер отрезка, который будет добавлен следующим.
+	size_t get_next_index() const {
+		return next_index_;
+	}
+
+
+	/** Добавляет входные данные на очередном отрезке (с номером get_next_index()).
+	 *
+	 * Если история заполнена, самый старый отрезок вытесняется. При нулевой
+	 * ёмкости данные не сохраняются, но нумерация отрезков продолжается.
+	 */
+	void push (const I & value) {
+		if (! values_.empty()) {
+			values_[next_index_ % values_.size()] = value;
+			if (count_ < values_.size())
+				++count_;
+		}
+		++next_index_;
+	}
+
+	//! Возвращает, хранится ли в истории отрезок с номером idx.
+	bool contains (size_t idx) const {
+		return idx < next_index_ && idx + count_ >= next_index_;
+	}
+
+	/** Возвращает входные данные на отрезке с номером idx.
+	 *
+	 * @throws std::out_of_range Кидает исключение, если этого отрезка в истории нет (см. contains()).
+	 */
+	const I & operator[] (size_t idx) const {
+		if (! contains (idx))
+			throw std::out_of_range ("Входных данных на этом отрезке нет в истории.");
+		return values_[idx % values_.size()];
+	}
+
+
+private:
+
+
+	//! Кольцевой буфер: отрезок с номером idx хранится в элементе idx % get_capacity().
+	std::vector<I> values_;
+	//! Число отрезков, хранящихся в истории.
+	size_t count_;
+	//! Номер отрезка, который будет добавлен следующим.
+	size_t next_index_;
+
+
+}; // class increments_history
+
+
+
+#endif // ifndef ALGORITHMS_STUFF_INCREMENTS_HISTORY_H
@@ -8,7 +8,36 @@
 
 
 
+#include <boost/cstdint.hpp>
 #include <stdexcept>
+#include <vector>
+
+
+
+/** Счётчики обращений к источнику входных данных (см. input_data::get_counters()).
+ *
+ * Позволяют оценить, какая часть работы алгоритма уходит на получение
+ * входных данных (в частности, на численное интегрирование).
+ */
+struct input_data_counters {
+
+	//! Число запросов мгновенных данных.
+	boost::uint64_t instanteous_calls;
+	//! Число запрошенных интегральных данных (каждый отрезок get_integrated_range() считается отдельно).
+	boost::uint64_t integrated_calls;
+	//! Число вычислений подынтегральной функции, потраченных на интегральные данные.
+	boost::uint64_t integrand_evaluations;
+	//! Число интегральных данных, полученных без вычислений подынтегральной функции (из заранее посчитанной таблицы, аналитически и т.п.).
+	boost::uint64_t unmetered_integrated_calls;
+
+	input_data_counters()
+		: instanteous_calls (0),
+		  integrated_calls (0),
+		  integrand_evaluations (0),
+		  unmetered_integrated_calls (0)
+	{ }
+
+}; // struct input_data_counters
 
 
 
@@ -26,6 +55,8 @@
  * данные, для которых класс-потомок input_data не предоставит реализацию, то
  * дело дойдёт до этого исключения.
  *
+ * Источник может вести счётчики обращений к нему (см. get_counters()).
+ *
  * @tparam Q Выбранная алгебра (кватернионы/бикватернионы).
  * @tparam I Выбранный тип входных данных.
  */
@@ -67,6 +98,30 @@ public:
 		throw std::runtime_error ("Not implemented: integrated input data was not calculated.");
 	}
 
+	/** Возвращает интегральные входные данные на каждом из count подряд идущих отрезков длины step, начиная с момента t0.
+	 *
+	 * Данные на k-ом отрезке [t0+k*step; t0+(k+1)*step] записываются в
+	 * result[k]. По умолчанию просто вызывает get_integrated() для каждого
+	 * отрезка; классы-потомки могут переопределять этот метод, если данные
+	 * на целой сетке отрезков можно получить быстрее.
+	 *
+	 * @param result Массив, в который записываются результаты (его размер становится равным count).
+	 */
+	virtual void get_integrated_range (long double t0, long double step, size_t count, std::vector<I> & result) {
+		result.resize (count);
+		for (size_t k=0; k<count; ++k)
+			result[k] = get_integrated (t0 + step * k, t0 + step * (k + 1));
+	}
+
+
+	/** Возвращает счётчики обращений к источнику.
+	 *
+	 * По умолчанию источник счётчиков не ведёт и возвращает нули.
+	 */
+	virtual input_data_counters get_counters() const {
+		return input_data_counters();
+	}
+
 
 }; // class input_data
 
@@ -0,0 +1,72 @@
+/** \file iterate_steps.hpp
+    \brief Содержит функцию iterate_steps() - общий цикл последовательного запуска итеративных алгоритмов (см. iterative_algorithm и static_iterative_algorithm).
+*/
+
+#pragma once
+#ifndef ALGORITHMS_STUFF_ITERATE_STEPS_H
+#define ALGORITHMS_STUFF_ITERATE_STEPS_H
+
+
+
+#include <algorithm>
+#include <vector>
+#include "increments_history.hpp"
+#include "input_data.hpp"
+#include "output_data.hpp"
+#include "solution_accumulator.hpp"
+
+
+
+/** Последовательно вычисляет решения во все моменты времени result.ts (кроме нулевого).
+ *
+ * На каждом шаге входные данные на gamma.size() подотрезках шага
+ * записываются в gamma (и в историю history, если у неё ненулевая
+ * ёмкость), решение на шаге находится вызовом local_solution (t, gamma), а
+ * ответ - умножением на него (см. solution_accumulator).
+ *
+ * Входные данные запрашиваются сразу для блока из block_steps шагов (см.
+ * input_data::get_integrated_range()), чтобы источник данных мог обработать
+ * всю сетку отрезков за один проход; память под блок выделяется один раз,
+ * до начала цикла.
+ *
+ * @param data Источник входных данных.
+ * @param step Шаг алгоритма.
+ * @param history История входных данных алгоритма.
+ * @param result Выходные данные с заполненными временами и начальным решением.
+ * @param gamma Контейнер входных данных на шаге (std::vector или boost::array); его размер - шаговость алгоритма.
+ * @param local_solution Функтор вида Q (long double t, const Increments & gamma).
+ * @param accumulator Накопитель ответа, начальное значение которого - result[0].
+ */
+template <class Q, class I, class Increments, class LocalSolution>
+void iterate_steps (input_data<Q,I> & data, long double step, increments_history<I> & history,
+                    output_data<Q> & result, Increments & gamma, LocalSolution local_solution,
+                    solution_accumulator<Q> & accumulator)
+{
+	const size_t block_steps = 1024;
+	size_t steps_count = gamma.size();
+	long double delta_t = step / steps_count;
+
+	std::vector<I> increments;
+	increments.reserve (std::min (block_steps, result.get_count()) * steps_count);
+
+	for (size_t i=1; i<result.get_count(); ++i) {
+		// вычисляем входные данные
+		long double t = result.ts[i];
+		size_t pos = (i - 1) % block_steps;
+		if (pos == 0) {
+			size_t block = std::min (block_steps, result.get_count() - i);
+			data.get_integrated_range (t - step, delta_t, block * steps_count, increments);
+		}
+		std::copy (increments.begin() + pos * steps_count, increments.begin() + (pos + 1) * steps_count, gamma.begin());
+		if (history.get_capacity())
+			for (size_t j=0; j<steps_count; ++j)
+				history.push (gamma[j]);
+
+		// вычисляем решение на текущем временном отрезке и новый ответ
+		result[i] = accumulator.multiply (local_solution (t, gamma));
+	}
+}
+
+
+
+#endif // ifndef ALGORITHMS_STUFF_ITERATE_STEPS_H
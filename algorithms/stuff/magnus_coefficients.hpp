@@ -0,0 +1,294 @@
+/** \file magnus_coefficients.hpp
+    \brief Содержит класс "magnus_coefficients" - коэффициенты разложения вектора поворота по интегральным входным данным на N подотрезках (см. magnus_algorithm).
+*/
+
+#pragma once
+#ifndef ALGORITHMS_STUFF_MAGNUS_COEFFICIENTS_H
+#define ALGORITHMS_STUFF_MAGNUS_COEFFICIENTS_H
+
+
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/static_assert.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+
+
+/** Класс "magnus_coefficients" - коэффициенты разложения вектора поворота за шаг по входным данным на N подотрезках.
+ *
+ * Угловая скорость на шаге приближается многочленом степени N-1, интегралы
+ * которого по подотрезкам (длины h/N) равны входным данным gamma[0..N-1].
+ * Для такой скорости уравнение Бортца
+ * phi' = omega + 1/2 phi x omega + 1/12 phi x (phi x omega)
+ * решается последовательными приближениями (разложение Магнуса); следующие
+ * члены уравнения Бортца (phi^2/720 phi x (phi x omega) и т.д.) дают вклад
+ * начиная с пятого порядка по входным данным. Члены до четвёртого порядка
+ * выписываются через тензоры коэффициентов: обозначим c[jk] = gamma[j] x
+ * gamma[k] (j<k, пары нумеруются методом pair_index()); тогда
+ *
+ * phi = sum_i gamma[i]
+ *     + sum_{jk} second[jk] c[jk]
+ *     + sum_{jk} (sum_i third[jk][i] gamma[i]) x c[jk]
+ *     + sum_{b,jk} (sum_a fourth_a[b][jk][a] gamma[a]) x (gamma[b] x c[jk])
+ *     + sum_{ij<kl} fourth_b[ij][kl] c[ij] x c[kl].
+ *
+ * Коэффициенты - рациональные числа; они вычисляются точно (в дробях с
+ * длинными числителями и знаменателями) один раз для каждого N (см. get()).
+ * При N=2 и N=3 коэффициенты second - это классические 2/3 и 33/80, 57/80;
+ * при N=4 - 736/945, 334/945, 526/945 и 654/945.
+ *
+ * Отброшенные члены пятого порядка - порядка h^5, поэтому тензоры годятся
+ * лишь при N<=3: при большем N точность упиралась бы в обрезание ряда, а
+ * не в приближение скорости многочленом. Члены выше четвёртого порядка
+ * тензорами не выписываются (число слагаемых растёт как N^порядок); при
+ * N>=4 вектор поворота находится последовательными приближениями над
+ * многочленом скорости (см. velocity и magnus_series_rotation_vector()).
+ *
+ * @tparam N Число подотрезков на шаге (от 1 до 6).
+ */
+template <int N>
+class magnus_coefficients {
+
+	BOOST_STATIC_ASSERT_MSG( N >= 1 && N <= 6, "magnus_coefficients: N - от 1 до 6" );
+
+public:
+
+
+	//! Число пар (j,k), j<k.
+	static const int pairs_count = N * (N - 1) / 2;
+
+
+	//! Возвращает коэффициенты для данного N (вычисляются при первом вызове).
+	static const magnus_coefficients & get() {
+		static const magnus_coefficients instance;
+		return instance;
+	}
+
+
+	//! Возвращает номер пары (j,k), j<k, в списке всех таких пар (в порядке возрастания j, затем k).
+	static int pair_index (int j, int k) {
+		return j * (2 * N - j - 1) / 2 + (k - j - 1);
+	}
+
+
+	//! Члены второго порядка: second[jk] (pairs_count элементов).
+	std::vector<long double> second;
+	//! Члены третьего порядка: third[jk * N + i].
+	std::vector<long double> third;
+	//! Члены четвёртого порядка первого вида: fourth_a[(b * pairs_count + jk) * N + a].
+	std::vector<long double> fourth_a;
+	//! Члены четвёртого порядка второго вида: fourth_b[ij * pairs_count + kl] (ненулевые только при ij<kl).
+	std::vector<long double> fourth_b;
+
+	/** Многочлен скорости на шаге, нормированном на [-1; 1]: Omega(s) = sum_m s^m sum_i velocity[m * N + i] gamma[i].
+	 *
+	 * Интеграл Omega по i-му из N равных кусков [-1; 1] равен gamma[i].
+	 * Степени s от центра шага обусловлены гораздо лучше, чем степени tau.
+	 */
+	std::vector<long double> velocity;
+
+
+private:
+
+
+	//! Рациональное число произвольной точности.
+	typedef boost::multiprecision::cpp_rational t_rational;
+	//! Тензор с N^rank элементами, индексы которого записываются по порядку (первый - старший).
+	typedef std::vector<t_rational> t_tensor;
+
+
+	//! Матрица перехода от входных данных к коэффициентам многочлена: a[m] = sum_i B[m][i] gamma[i].
+	t_rational B_[N][N];
+
+
+	/** Вычисляет коэффициенты.
+	 *
+	 * Время шага нормируется так, что подотрезки имеют единичную длину:
+	 * tau из [0; N]. Скорость omega(tau) = sum_m a[m] tau^m, поэтому члены
+	 * разложения, выписанные через a[m], - это интегралы от степеней tau,
+	 * т.е. рациональные числа. Подстановка a через gamma (см.
+	 * substitute_()) даёт искомые коэффициенты.
+	 */
+	magnus_coefficients() {
+		invert_moments_();
+
+		// tau = N (1 + s) / 2, Omega(s) = N/2 omega(tau) = sum_m a[m] (N/2)^(m+1) sum_l C(m,l) s^l
+		velocity.resize (N * N);
+		for (int l=0; l<N; ++l)
+			for (int i=0; i<N; ++i) {
+				t_rational value = 0, binomial = 1;
+				for (int m=l; m<N; ++m) {
+					value += binomial * B_[m][i] * power_ (m + 1) / t_rational (1 << (m + 1));
+					binomial = binomial * (m + 1) / (m + 1 - l);
+				}
+				velocity[l * N + i] = to_long_double_ (value);
+			}
+
+		// alpha(tau) = sum_m a[m] tau^(m+1) / (m+1) - первое приближение;
+		// phi2(tau) = 1/2 int alpha x omega = sum_{mn} (a[m] x a[n]) tau^(m+n+2) / (2 (m+1) (m+n+2))
+		t_tensor second_order (N * N);
+		for (int m=0; m<N; ++m)
+			for (int n=0; n<N; ++n)
+				second_order[m * N + n] = power_ (m + n + 2) / t_rational (2 * (m + 1) * (m + n + 2));
+
+		// phi3(tau) = int (1/2 phi2 x omega + 1/12 alpha x (alpha x omega)) = sum_{pqr} V3[pqr] (a[p] x (a[q] x a[r])) tau^(p+q+r+3),
+		// с учётом (a[m] x a[n]) x a[p] = - a[p] x (a[m] x a[n])
+		t_tensor third_order_function (N * N * N);
+		for (int m=0; m<N; ++m)
+			for (int n=0; n<N; ++n)
+				for (int p=0; p<N; ++p) {
+					int e = m + n + p + 3;
+					third_order_function[(p * N + m) * N + n] -= t_rational (1, 4 * (m + 1) * (m + n + 2) * e);
+					third_order_function[(m * N + n) * N + p] += t_rational (1, 12 * (m + 1) * (n + 1) * e);
+				}
+
+		t_tensor third_order (N * N * N);
+		for (int p=0; p<N; ++p)
+			for (int q=0; q<N; ++q)
+				for (int r=0; r<N; ++r)
+					third_order[(p * N + q) * N + r] = third_order_function[(p * N + q) * N + r] * power_ (p + q + r + 3);
+
+		// phi4 = int (1/2 phi3 x omega + 1/12 alpha x (phi2 x omega) + 1/12 phi2 x (alpha x omega)):
+		// первые два слагаемых дают члены вида a[s] x (a[p] x (a[q] x a[r])), третье - (a[q] x a[r]) x (a[m] x a[s])
+		t_tensor fourth_order_a (N * N * N * N), fourth_order_b (N * N * N * N);
+		for (int s=0; s<N; ++s)
+			for (int p=0; p<N; ++p)
+				for (int q=0; q<N; ++q)
+					for (int r=0; r<N; ++r) {
+						int e = p + q + r + s + 4;
+						t_rational integral = power_ (e) / t_rational (e);
+						fourth_order_a[((s * N + p) * N + q) * N + r] -= third_order_function[(p * N + q) * N + r] * integral / 2;
+						fourth_order_a[((p * N + s) * N + q) * N + r] -= integral / t_rational (24 * (p + 1) * (q + 1) * (q + r + 2));
+						fourth_order_b[((q * N + r) * N + p) * N + s] += integral / t_rational (24 * (q + 1) * (q + r + 2) * (p + 1));
+					}
+
+		// подстановка a через gamma
+		second_order = substitute_ (second_order, 2);
+		third_order = substitute_ (third_order, 3);
+		fourth_order_a = substitute_ (fourth_order_a, 4);
+		fourth_order_b = substitute_ (fourth_order_b, 4);
+
+		// приведение к независимым парам j<k
+		second.assign (pairs_count, 0);
+		third.assign (pairs_count * N, 0);
+		fourth_a.assign (N * pairs_count * N, 0);
+		fourth_b.assign (pairs_count * pairs_count, 0);
+
+		for (int j=0; j<N; ++j)
+			for (int k=j+1; k<N; ++k) {
+				int jk = pair_index (j, k);
+				second[jk] = to_long_double_ (second_order[j * N + k] - second_order[k * N + j]);
+
+				for (int i=0; i<N; ++i) {
+					third[jk * N + i] = to_long_double_ (third_order[(i * N + j) * N + k] - third_order[(i * N + k) * N + j]);
+
+					for (int a=0; a<N; ++a)
+						fourth_a[(i * pairs_count + jk) * N + a] = to_long_double_ (
+							fourth_order_a[((a * N + i) * N + j) * N + k] - fourth_order_a[((a * N + i) * N + k) * N + j]
+						);
+				}
+
+				for (int l=0; l<N; ++l)
+					for (int m=l+1; m<N; ++m) {
+						int lm = pair_index (l, m);
+						if (lm <= jk)
+							continue;
+						fourth_b[jk * pairs_count + lm] = to_long_double_ (
+							antisymmetric_pairs_ (fourth_order_b, j, k, l, m) - antisymmetric_pairs_ (fourth_order_b, l, m, j, k)
+						);
+					}
+			}
+	}
+
+
+	//! Возвращает N^e.
+	static t_rational power_ (int e) {
+		t_rational result = 1;
+		for (int k=0; k<e; ++k)
+			result *= N;
+		return result;
+	}
+
+	static long double to_long_double_ (const t_rational & value) {
+		return value.template convert_to<long double>();
+	}
+
+	//! Коэффициент при (gamma[i] x gamma[j]) x (gamma[k] x gamma[l]) с учётом антисимметричности каждой пары.
+	static t_rational antisymmetric_pairs_ (const t_tensor & X, int i, int j, int k, int l) {
+		return X[((i * N + j) * N + k) * N + l] - X[((j * N + i) * N + k) * N + l]
+			- X[((i * N + j) * N + l) * N + k] + X[((j * N + i) * N + l) * N + k];
+	}
+
+
+	/** Переводит тензор ранга rank из базиса a[m] в базис gamma[i].
+	 *
+	 * Y[i1...ik] = sum X[m1...mk] B[m1][i1] ... B[mk][ik]; свёртка ведётся
+	 * по одному индексу за раз.
+	 */
+	t_tensor substitute_ (t_tensor X, int rank) const {
+		int stride = 1;
+		for (int pos=0; pos<rank; ++pos) {
+			t_tensor Y (X.size());
+			for (size_t idx=0; idx<X.size(); ++idx) {
+				int i = (idx / stride) % N;
+				size_t base = idx - i * stride;
+				for (int m=0; m<N; ++m)
+					Y[idx] += X[base + m * stride] * B_[m][i];
+			}
+			X.swap (Y);
+			stride *= N;
+		}
+		return X;
+	}
+
+
+	//! Вычисляет B = M^-1, где M[i][m] = ((i+1)^(m+1) - i^(m+1)) / (m+1) (метод Гаусса-Жордана).
+	void invert_moments_() {
+		t_rational A[N][2 * N];
+		for (int i=0; i<N; ++i)
+			for (int m=0; m<N; ++m) {
+				t_rational hi = 1, lo = 1;
+				for (int e=0; e<=m; ++e) {
+					hi *= i + 1;
+					lo *= i;
+				}
+				A[i][m] = (hi - lo) / t_rational (m + 1);
+				A[i][N + m] = (i == m) ? 1 : 0;
+			}
+
+		for (int c=0; c<N; ++c) {
+			int pivot = c;
+			while (A[pivot][c] == 0)
+				++pivot;
+			for (int col=0; col<2*N; ++col)
+				std::swap (A[c][col], A[pivot][col]);
+
+			t_rational value = A[c][c];
+			for (int col=0; col<2*N; ++col)
+				A[c][col] /= value;
+
+			for (int r=0; r<N; ++r)
+				if (r != c && A[r][c] != 0) {
+					t_rational factor = A[r][c];
+					for (int col=0; col<2*N; ++col)
+						A[r][col] -= factor * A[c][col];
+				}
+		}
+
+		for (int m=0; m<N; ++m)
+			for (int i=0; i<N; ++i)
+				B_[m][i] = A[m][N + i];
+	}
+
+
+}; // class magnus_coefficients
+
+
+template <int N>
+const int magnus_coefficients<N>::pairs_count;
+
+
+
+#endif // ifndef ALGORITHMS_STUFF_MAGNUS_COEFFICIENTS_H
@@ -9,6 +9,7 @@
 
 
 #include <vector>
+#include "../../constants.hpp"
 
 
 
@@ -35,6 +36,26 @@ public:
 	std::vector<Q> qs;
 
 
+	/** Заполняет список времён моментами 0; step; 2*step; ... (до last_time включительно) и выделяет место под решения.
+	 *
+	 * Моменты времени вычисляются последовательным прибавлением шага (так
+	 * что совпадают с теми, что получались бы при добавлении записей по
+	 * одной), но их число находится заранее, и память под оба списка
+	 * выделяется один раз.
+	 */
+	void init_grid (long double step, long double last_time) {
+		size_t count = 0;
+		for (long double t=0; t<=last_time+EPS; t+=step)
+			++count;
+
+		ts.resize (count);
+		qs.resize (count);
+		long double t = 0;
+		for (size_t i=0; i<count; ++i, t+=step)
+			ts[i] = t;
+	}
+
+
 	/** Добавляет очередную запись-результаты алгоритма.
 	 *
 	 * Предполагается, что этот метод вызывается в порядке увеличения времён.
@@ -69,4 +90,19 @@ public:
 
 
 
+/** Вычисляет расстояния между решениями a[i] и b[i] во все моменты времени (см. distance()).
+ *
+ * Для массивов по компонентам есть перегрузка, вычисляющая расстояния
+ * пакетно (см. basic_quaternion_array).
+ */
+template <typename Q, typename T>
+void batch_distance (const std::vector<Q> & a, const std::vector<Q> & b, std::vector<T> & result) {
+	size_t count = a.size();
+	result.resize (count);
+	for (size_t i=0; i<count; ++i)
+		result[i] = distance (a[i], b[i]);
+}
+
+
+
 #endif // ifndef ALGORITHMS_STUFF_OUTPUT_DATA_H
@@ -0,0 +1,269 @@
+/** \file rotation_functions.hpp
+    \brief Содержит функции перехода от вектора поворота к кватерниону поворота (и к решению по типу Риккати).
+
+	Почти все алгоритмы на каждом шаге вычисляют cos(phi_m/2),
+	sin(phi_m/2)/phi_m или tan(phi_m/4)/phi_m, где phi_m - длина вектора
+	поворота на текущем отрезке. При используемых шагах phi_m мал, и эти
+	функции дешевле и точнее вычислять по отрезку ряда Тейлора, чем через
+	sin/cos/tan (к тому же ряд не требует деления на phi_m, так что
+	phi_m = 0 не является особым случаем).
+*/
+
+#pragma once
+#ifndef ALGORITHMS_STUFF_ROTATION_FUNCTIONS_H
+#define ALGORITHMS_STUFF_ROTATION_FUNCTIONS_H
+
+
+
+#include <boost/typeof/typeof.hpp>
+#include <cmath>
+#include "../../types/scalar.hpp"
+
+
+
+template <typename T>
+class basic_dual_number;
+
+
+//! Возвращает, не превосходит ли длина вектора поворота phi_m (по модулю) величину limit.
+template <typename T>
+inline bool is_small_rotation_angle (const T & phi_m, long double limit) {
+	return fabs (phi_m) <= limit;
+}
+
+//! Для дуальных чисел сравнивается действительная часть.
+template <typename T>
+inline bool is_small_rotation_angle (const basic_dual_number<T> & phi_m, long double limit) {
+	return is_small_rotation_angle (phi_m.real, limit);
+}
+
+
+
+/** Класс "rotation_functions" - функции от длины вектора поворота phi_m, нужные для перехода к кватерниону поворота.
+ *
+ * В общем случае (например, для __float128 или дуальных чисел) функции
+ * вычисляются прямо по формулам через sin, cos и tan, а при малых phi_m
+ * (см. is_small_rotation_angle()) - через ряд для sin(z)/z, коэффициенты
+ * которого находятся в самом типе T (см. sin_ratio_()); поэтому phi_m = 0
+ * и здесь не особый случай. Для float, double и long double имеются
+ * специализации, вычисляющие функции по ряду (см. rotation_series_functions).
+ *
+ * @tparam T Тип длины вектора поворота.
+ */
+template <typename T>
+class rotation_functions {
+
+public:
+
+
+	//! Возвращает cos(phi_m/2).
+	static T half_angle_cos (const T & phi_m) {
+		return cos (phi_m / 2);
+	}
+
+	//! Возвращает sin(phi_m/2)/phi_m (в том числе 1/2 при phi_m = 0).
+	static T half_angle_sinc (const T & phi_m) {
+		if (is_small_rotation_angle (phi_m, series_limit_))
+			return sin_ratio_ (phi_m / 2) / 2;
+		return sin (phi_m / 2) / phi_m;
+	}
+
+	//! Возвращает tan(phi_m/4)/phi_m (в том числе 1/4 при phi_m = 0).
+	static T quarter_angle_tanc (const T & phi_m) {
+		if (is_small_rotation_angle (phi_m, series_limit_))
+			return sin_ratio_ (phi_m / 4) / (cos (phi_m / 4) * 4);
+		return tan (phi_m / 4) / phi_m;
+	}
+
+
+private:
+
+
+	/** Наибольшая длина вектора поворота, для которой используется ряд.
+	 *
+	 * При |z| <= 0.05 отброшенный член ряда sin_ratio_() меньше 10^-40,
+	 * т.е. ниже точности и __float128.
+	 */
+	static const long double series_limit_;
+
+
+	//! Возвращает sin(z)/z по ряду sum (-z^2)^k / (2k+1)!, k = 0..9.
+	static T sin_ratio_ (const T & z) {
+		T u = z * z;
+		T term = T (1), result = T (1);
+		for (int k=1; k<10; ++k) {
+			term = term * u / T (- (2 * k) * (2 * k + 1));
+			result = result + term;
+		}
+		return result;
+	}
+
+
+}; // class rotation_functions
+
+
+template <typename T>
+const long double rotation_functions<T>::series_limit_ = 0.1L;
+
+
+
+/** Класс "rotation_series_functions" - функции класса rotation_functions, вычисляемые по отрезку ряда Тейлора.
+ *
+ * Все три функции чётные, так что ряды берутся по степеням u = phi_m^2 и
+ * вычисляются по схеме Горнера. При |phi_m| <= max_angle() первые Terms
+ * членов ряда дают ошибку усечения меньше половины единицы последнего
+ * разряда типа T; при больших phi_m функции вычисляются через std::sin,
+ * std::cos и std::tan.
+ *
+ * @tparam T Тип с плавающей точкой.
+ * @tparam Terms Число членов ряда (не больше 10).
+ */
+template <typename T, int Terms>
+class rotation_series_functions {
+
+public:
+
+
+	/** Возвращает наибольшую длину вектора поворота, для которой используется ряд.
+	 *
+	 * Это заведомо больше длин, встречающихся при используемых шагах (сотые и
+	 * десятые доли радиана).
+	 */
+	static T max_angle() {
+		return T (0.5);
+	}
+
+
+	//! Возвращает cos(phi_m/2).
+	static T half_angle_cos (const T & phi_m) {
+		if (std::fabs (phi_m) > max_angle())
+			return std::cos (phi_m / 2);
+
+		// (-1)^k / (4^k (2k)!)
+		static const T c[] = {
+			T (1.000000000000000000000000E0L), T (-1.250000000000000000000000E-1L),
+			T (2.604166666666666666666667E-3L), T (-2.170138888888888888888889E-5L),
+			T (9.688120039682539682539683E-8L), T (-2.691144455467372134038801E-10L),
+			T (5.096864498991235102346213E-13L), T (-7.001187498614333931794249E-16L),
+			T (7.292903644389931178952343E-19L), T (-5.958254611429682335745378E-22L)
+		};
+		return horner_ (c, phi_m * phi_m);
+	}
+
+	//! Возвращает sin(phi_m/2)/phi_m (в том числе 1/2 при phi_m = 0).
+	static T half_angle_sinc (const T & phi_m) {
+		if (std::fabs (phi_m) > max_angle())
+			return std::sin (phi_m / 2) / phi_m;
+
+		// (-1)^k / (2^(2k+1) (2k+1)!)
+		static const T c[] = {
+			T (5.000000000000000000000000E-1L), T (-2.083333333333333333333333E-2L),
+			T (2.604166666666666666666667E-4L), T (-1.550099206349206349206349E-6L),
+			T (5.382288910934744268077601E-9L), T (-1.223247479757896424563091E-11L),
+			T (1.960332499612013500902390E-14L), T (-2.333729166204777977264750E-17L),
+			T (2.144971660114685640868336E-20L), T (-1.567961739849916404143521E-23L)
+		};
+		return horner_ (c, phi_m * phi_m);
+	}
+
+	//! Возвращает tan(phi_m/4)/phi_m (в том числе 1/4 при phi_m = 0).
+	static T quarter_angle_tanc (const T & phi_m) {
+		if (std::fabs (phi_m) > max_angle())
+			return std::tan (phi_m / 4) / phi_m;
+
+		// коэффициенты ряда tan(z) при z = phi_m/4, делённые на phi_m
+		static const T c[] = {
+			T (2.500000000000000000000000E-1L), T (5.208333333333333333333333E-3L),
+			T (1.302083333333333333333333E-4L), T (3.293960813492063492063492E-6L),
+			T (8.342547811948853615520282E-8L), T (2.113160021281766073432740E-9L),
+			T (5.352687890190602864213975E-11L), T (1.355851429562380787217510E-12L),
+			T (3.434411721220158397790953E-14L), T (8.699466497766570009325058E-16L)
+		};
+		return horner_ (c, phi_m * phi_m);
+	}
+
+
+private:
+
+
+	//! Вычисляет c[0] + c[1]*u + ... + c[Terms-1]*u^(Terms-1) по схеме Горнера.
+	static T horner_ (const T * c, T u) {
+		T result = c[Terms - 1];
+		for (int k=Terms-2; k>=0; --k)
+			result = result * u + c[k];
+		return result;
+	}
+
+
+}; // class rotation_series_functions
+
+
+
+//! Функции rotation_functions для float: 5 членов ряда.
+template <>
+class rotation_functions<float> : public rotation_series_functions<float,5> {
+}; // class rotation_functions<float>
+
+//! Функции rotation_functions для double: 8 членов ряда.
+template <>
+class rotation_functions<double> : public rotation_series_functions<double,8> {
+}; // class rotation_functions<double>
+
+//! Функции rotation_functions для long double: 10 членов ряда.
+template <>
+class rotation_functions<long double> : public rotation_series_functions<long double,10> {
+}; // class rotation_functions<long double>
+
+
+
+//! Возвращает cos(phi_m/2) (см. rotation_functions).
+template <typename T>
+inline T half_angle_cos (const T & phi_m) {
+	return rotation_functions<T>::half_angle_cos (phi_m);
+}
+
+//! Возвращает sin(phi_m/2)/phi_m (см. rotation_functions).
+template <typename T>
+inline T half_angle_sinc (const T & phi_m) {
+	return rotation_functions<T>::half_angle_sinc (phi_m);
+}
+
+//! Возвращает tan(phi_m/4)/phi_m (см. rotation_functions).
+template <typename T>
+inline T quarter_angle_tanc (const T & phi_m) {
+	return rotation_functions<T>::quarter_angle_tanc (phi_m);
+}
+
+
+
+/** Возвращает кватернион поворота на вектор phi: (cos(phi_m/2), phi*sin(phi_m/2)/phi_m), где phi_m - длина phi.
+ *
+ * @tparam Q Выбранная алгебра (кватернионы/бикватернионы).
+ * @tparam V Тип вектора поворота.
+ */
+template <typename Q, typename V>
+inline Q rotation_quaternion (const V & phi) {
+	BOOST_AUTO( phi_m, phi.length() );
+
+	return Q (
+		half_angle_cos (phi_m),
+		phi * half_angle_sinc (phi_m)
+	);
+}
+
+
+/** Возвращает решение по типу Риккати для поворота на вектор phi: phi*tan(phi_m/4)/phi_m, где phi_m - длина phi.
+ *
+ * @tparam Q Выбранная алгебра (кватернионы/бикватернионы).
+ * @tparam V Тип вектора поворота.
+ */
+template <typename Q, typename V>
+inline Q rotation_riccati_solution (const V & phi) {
+	BOOST_AUTO( phi_m, phi.length() );
+
+	return Q (phi * quarter_angle_tanc (phi_m));
+}
+
+
+
+#endif // ifndef ALGORITHMS_STUFF_ROTATION_FUNCTIONS_H
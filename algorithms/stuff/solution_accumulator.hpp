@@ -0,0 +1,202 @@
+/** \file solution_accumulator.hpp
+    \brief Содержит класс "solution_accumulator" - накопитель ответа итеративного алгоритма (произведения решений на отрезках).
+*/
+
+#pragma once
+#ifndef ALGORITHMS_STUFF_SOLUTION_ACCUMULATOR_H
+#define ALGORITHMS_STUFF_SOLUTION_ACCUMULATOR_H
+
+
+
+#include <cmath>
+#include <limits>
+#include "../../types/quaternion.hpp"
+
+
+
+/** Способ накопления ответа итеративного алгоритма (см. iterative_algorithm::set_accumulation()).
+ */
+enum accumulation_mode {
+	//! Ответ хранится в той же алгебре, что и решения на отрезках.
+	native_accumulation,
+	//! Ответ хранится в кватернионе с компонентами типа long double.
+	long_double_accumulation,
+	/** Ответ хранится в кватернионе с компонентами двойной-двойной точности (пара double "старшая часть + младшая часть").
+	 *
+	 * Решения на отрезках при этом округляются до double, поэтому для
+	 * компонент шире double (long double, __float128) режим не действует и
+	 * работает как native_accumulation.
+	 */
+	double_double_accumulation
+};
+
+
+
+/** Класс "solution_accumulator" - накопитель ответа итеративного алгоритма.
+ *
+ * Ответ в очередной момент времени - это ответ в предыдущий момент,
+ * умноженный на решение на текущем отрезке (см. multiply()). Погрешность
+ * этих умножений накапливается на сотнях тысяч шагов, поэтому ответ можно
+ * хранить с повышенной точностью, даже если сами решения на отрезках
+ * вычисляются, скажем, в double (см. accumulation_mode).
+ *
+ * В общем случае ответ хранится как есть; повышенная точность
+ * поддерживается для кватернионов (см. специализацию для basic_quaternion).
+ *
+ * @tparam Q Выбранная алгебра (кватернионы/бикватернионы).
+ */
+template <typename Q>
+class solution_accumulator {
+
+public:
+
+
+	solution_accumulator (accumulation_mode mode, const Q & initial)
+		: value_ (initial)
+	{ }
+
+
+	//! Умножает ответ справа на q и возвращает новый ответ.
+	Q multiply (const Q & q) {
+		value_ = value_ * q;
+		return value_;
+	}
+
+
+private:
+
+
+	//! Текущий ответ.
+	Q value_;
+
+
+}; // class solution_accumulator
+
+
+
+/** Накопитель ответа для кватернионов с компонентами типа T.
+ *
+ * В режиме double_double_accumulation каждая компонента ответа хранится
+ * как несократимая сумма hi + lo двух чисел double, а произведение
+ * вычисляется без потери младших разрядов (преобразования TwoSum и
+ * TwoProduct). Это даёт около 106 значащих бит при скорости
+ * арифметики double.
+ *
+ * Для T шире double (long double, __float128) режим double_double_accumulation
+ * заменяется на native_accumulation: множители пришлось бы округлять до
+ * double, и ответ получился бы грубее, чем в самом типе T.
+ */
+template <typename T>
+class solution_accumulator< basic_quaternion<T> > {
+
+public:
+
+
+	solution_accumulator (accumulation_mode mode, const basic_quaternion<T> & initial)
+		: mode_ (mode == double_double_accumulation && std::numeric_limits<T>::digits > std::numeric_limits<double>::digits ? native_accumulation : mode),
+		  value_ (initial),
+		  extended_ (initial)
+	{
+		for (int c=0; c<4; ++c) {
+			hi_[c] = (double) initial[c];
+			lo_[c] = (double) (initial[c] - (T) hi_[c]);
+		}
+	}
+
+
+	//! Умножает ответ справа на q и возвращает новый ответ (округлённый до типа T).
+	basic_quaternion<T> multiply (const basic_quaternion<T> & q) {
+		switch (mode_) {
+		case long_double_accumulation:
+			extended_ *= basic_quaternion<long double> (q);
+			return basic_quaternion<T> (extended_);
+
+		case double_double_accumulation:
+			multiply_double_double_ (q);
+			return basic_quaternion<T> (
+				(T) hi_[0] + (T) lo_[0], (T) hi_[1] + (T) lo_[1],
+				(T) hi_[2] + (T) lo_[2], (T) hi_[3] + (T) lo_[3]
+			);
+
+		default:
+			value_ *= q;
+			return value_;
+		}
+	}
+
+
+private:
+
+
+	//! Способ накопления.
+	accumulation_mode mode_;
+	//! Ответ в режиме native_accumulation.
+	basic_quaternion<T> value_;
+	//! Ответ в режиме long_double_accumulation.
+	basic_quaternion<long double> extended_;
+	//! Старшие части компонент ответа (w, x, y, z) в режиме double_double_accumulation.
+	double hi_[4];
+	//! Младшие части компонент ответа в режиме double_double_accumulation.
+	double lo_[4];
+
+
+	//! Точная сумма a + b = s + e (TwoSum).
+	static void two_sum_ (double a, double b, double & s, double & e) {
+		s = a + b;
+		double bb = s - a;
+		e = (a - (s - bb)) + (b - bb);
+	}
+
+	/** Точное произведение a * b = p + e (TwoProduct).
+	 *
+	 * Если процессор умеет FMA, то компилятор вправе сливать умножения со
+	 * сложениями (-ffp-contract), и разбиение Деккера перестаёт быть точным.
+	 * Поэтому в этом случае погрешность находится одной операцией fma(),
+	 * а разбиение Деккера используется только без FMA.
+	 */
+	static void two_product_ (double a, double b, double & p, double & e) {
+		p = a * b;
+#if defined(FP_FAST_FMA) || defined(__FP_FAST_FMA)
+		e = fma (a, b, -p);
+#else
+		const double split = 134217729.0; // 2^27 + 1
+		double ta = split * a, a_hi = ta - (ta - a), a_lo = a - a_hi;
+		double tb = split * b, b_hi = tb - (tb - b), b_lo = b - b_hi;
+		e = ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+#endif
+	}
+
+
+	//! Умножает ответ двойной-двойной точности справа на кватернион q.
+	void multiply_double_double_ (const basic_quaternion<T> & q) {
+		const double b[4] = { (double) q.w, (double) q.x, (double) q.y, (double) q.z };
+
+		// компонента c произведения - это сумма по j слагаемых sign[c][j] * a[j] * b[index[c][j]]
+		static const int index[4][4] = { {0, 1, 2, 3}, {1, 0, 3, 2}, {2, 3, 0, 1}, {3, 2, 1, 0} };
+		static const double sign[4][4] = { {1, -1, -1, -1}, {1, 1, 1, -1}, {1, -1, 1, 1}, {1, 1, -1, 1} };
+
+		double new_hi[4], new_lo[4];
+		for (int c=0; c<4; ++c) {
+			double s = 0, e = 0;
+			for (int j=0; j<4; ++j) {
+				double bj = sign[c][j] * b[index[c][j]];
+				double p, pe, se;
+				two_product_ (hi_[j], bj, p, pe);
+				two_sum_ (s, p, s, se);
+				e += se + pe + lo_[j] * bj;
+			}
+			two_sum_ (s, e, new_hi[c], new_lo[c]);
+		}
+
+		for (int c=0; c<4; ++c) {
+			hi_[c] = new_hi[c];
+			lo_[c] = new_lo[c];
+		}
+	}
+
+
+}; // class solution_accumulator
+
+
+
+#endif // ifndef ALGORITHMS_STUFF_SOLUTION_ACCUMULATOR_H
@@ -0,0 +1,69 @@
+/** \file analytic_increments.cpp
+    \brief Сравнение скорости вычисления интегральных данных по методу Симпсона и в режиме "аналитических приращений" (см. класс artifical_input_plane_angles_harmonious).
+
+	Для каждого шага h (как в main.cpp) вычисляются приращения на отрезках
+	длины h; метод Симпсона берётся с шагом h/10, как в main.cpp. В качестве
+	эталона используется метод Симпсона с шагом h/2000 (на первых отрезках).
+*/
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "benchmark.hpp"
+#include "../integrator/integrator.hpp"
+#include "../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../types/plane_angles.hpp"
+
+
+
+//! Вычисляет приращения на count отрезках длины h и возвращает среднее время на один отрезок (в наносекундах).
+long double measure (artifical_input<quaternion,vector3> & input, long double h, int count, std::vector<vector3> & increments) {
+	BOOST_AUTO( data, input.get_input_data() );
+	increments.resize (count);
+
+	benchmark_timer timer;
+	for (int i=0; i<count; ++i)
+		increments[i] = data->get_integrated (h * i, h * (i + 1));
+	double ns = timer.elapsed_ns();
+
+	benchmark_keep (increments[count-1]);
+	return ns / count;
+}
+
+
+int main() {
+	std::cout.precision (3);
+
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
+		plane_angles (PI/2, PI, PI)
+	);
+
+	const long double time = 100;
+	const int reference_count = 50;
+
+	std::cout << "h\tsimpson, ns\tanalytic, ns\tspeedup\tsimpson error\tanalytic error" << std::endl;
+	for (long double h=0.8; h>1E-3; h/=2) {
+		int count = int (time / h);
+		std::vector<vector3> simpson, analytic, reference;
+
+		input.set_analytic_increments (false);
+		input.set_integrator (boost::shared_ptr< integrator<vector3> > (new simpson_integrator<vector3> (h / 2000)));
+		measure (input, h, reference_count, reference);
+		input.set_integrator (boost::shared_ptr< integrator<vector3> > (new simpson_integrator<vector3> (h / 10)));
+		long double simpson_ns = measure (input, h, count, simpson);
+
+		input.set_analytic_increments (true);
+		long double analytic_ns = measure (input, h, count, analytic);
+
+		long double simpson_error = 0,
+			analytic_error = 0;
+		for (int i=0; i<reference_count; ++i) {
+			simpson_error = std::max (simpson_error, distance (simpson[i], reference[i]));
+			analytic_error = std::max (analytic_error, distance (analytic[i], reference[i]));
+		}
+
+		std::cout << std::fixed << (double) h << '\t' << (double) simpson_ns << '\t' << (double) analytic_ns << '\t'
+			<< (double) (simpson_ns / analytic_ns) << '\t'
+			<< std::scientific << (double) simpson_error << '\t' << (double) analytic_error << std::endl;
+	}
+}
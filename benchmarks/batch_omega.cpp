@@ -0,0 +1,57 @@
+/** \file batch_omega.cpp
+    \brief Сравнение скорости вычисления интегральных данных методом Симпсона: угловая скорость вычисляется по одной точке или пакетно, сразу во всех узлах (см. artifical_input_plane_angles::calc_omega_batch_()).
+
+	Входные данные - те же, что и в main.cpp. Для каждого шага h вычисляются
+	приращения на отрезках длины h методом Симпсона с шагом h/10.
+*/
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <boost/bind.hpp>
+#include "benchmark.hpp"
+#include "../integrator/integrator.hpp"
+#include "../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../types/plane_angles.hpp"
+
+
+
+int main() {
+	std::cout.precision (3);
+
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
+		plane_angles (PI/2, PI, PI)
+	);
+	BOOST_AUTO( data, input.get_input_data() );
+	BOOST_AUTO( func, boost::bind (&input_data<quaternion,vector3>::get_instanteous, data, _1) );
+
+	const long double time = 100;
+
+	std::cout << "h\tby point, ns\tbatch, ns\tspeedup\tmax difference" << std::endl;
+	for (long double h=0.8; h>1E-3; h/=2) {
+		int count = int (time / h);
+		simpson_integrator<vector3> integr (h / 10);
+		input.set_integrator (boost::shared_ptr< integrator<vector3> > (new simpson_integrator<vector3> (h / 10)));
+		std::vector<vector3> by_point (count), batch (count);
+
+		benchmark_timer timer;
+		for (int i=0; i<count; ++i)
+			by_point[i] = integr.integrate (func, h * i, h * (i + 1));
+		long double by_point_ns = timer.elapsed_ns() / count;
+
+		timer.restart();
+		for (int i=0; i<count; ++i)
+			batch[i] = data->get_integrated (h * i, h * (i + 1));
+		long double batch_ns = timer.elapsed_ns() / count;
+
+		benchmark_keep (by_point[count-1]);
+		benchmark_keep (batch[count-1]);
+
+		long double difference = 0;
+		for (int i=0; i<count; ++i)
+			difference = std::max (difference, distance (by_point[i], batch[i]));
+
+		std::cout << std::fixed << (double) h << '\t' << (double) by_point_ns << '\t' << (double) batch_ns << '\t'
+			<< (double) (by_point_ns / batch_ns) << '\t' << std::scientific << (double) difference << std::endl;
+	}
+}
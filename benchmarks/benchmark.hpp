@@ -0,0 +1,73 @@
+/** \file benchmark.hpp
+    \brief Содержит мелкие вспомогательные средства для замеров производительности (см. программы в папке benchmarks).
+*/
+
+#pragma once
+#ifndef BENCHMARKS_BENCHMARK_H
+#define BENCHMARKS_BENCHMARK_H
+
+
+
+#include <boost/chrono.hpp>
+
+
+
+/** Класс "benchmark_timer" - секундомер для замеров производительности.
+ *
+ * Отсчёт времени начинается в момент создания объекта (или последнего
+ * вызова restart()).
+ */
+class benchmark_timer {
+
+public:
+
+	benchmark_timer()
+		: start_ (clock_::now())
+	{ }
+
+	//! Перезапускает секундомер.
+	void restart() {
+		start_ = clock_::now();
+	}
+
+	//! Возвращает время в секундах, прошедшее с момента запуска секундомера.
+	double elapsed() const {
+		return boost::chrono::duration<double> (clock_::now() - start_) .count();
+	}
+
+	//! Возвращает время в наносекундах, прошедшее с момента запуска секундомера.
+	double elapsed_ns() const {
+		return boost::chrono::duration<double, boost::nano> (clock_::now() - start_) .count();
+	}
+
+private:
+
+	typedef boost::chrono::high_resolution_clock clock_;
+
+	//! Момент запуска секундомера.
+	clock_::time_point start_;
+
+}; // class benchmark_timer
+
+
+
+/** Не даёт компилятору выбросить вычисление значения как неиспользуемое.
+ *
+ * Для GCC и Clang адрес значения передаётся в пустую ассемблерную вставку,
+ * которая для компилятора читает память; иначе первый байт значения
+ * пропускается через volatile-переменную.
+ */
+template <class T>
+inline void benchmark_keep (const T & value) {
+#if defined(__GNUC__)
+	__asm__ __volatile__ ("" : : "r" (&value) : "memory");
+#else
+	static volatile char sink;
+	sink = * reinterpret_cast < const volatile char * > (&value);
+	(void) sink;
+#endif
+}
+
+
+
+#endif // ifndef BENCHMARKS_BENCHMARK_H
@@ -0,0 +1,74 @@
+/** \file gauss_legendre_vs_simpson.cpp
+    \brief Сравнение погрешности интегральных данных в зависимости от числа вычислений угловой скорости: метод Гаусса-Лежандра против метода Симпсона.
+
+	Входные данные - те же, что и в main.cpp. Эталоном служат интегральные
+	данные, посчитанные в режиме "аналитических приращений" (см. класс
+	artifical_input_plane_angles_harmonious).
+*/
+#include <algorithm>
+#include <iostream>
+#include "../integrator/integrator.hpp"
+#include "../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../types/plane_angles.hpp"
+
+
+
+//! Число отрезков, по которым берётся наибольшая погрешность.
+static const int intervals_count = 200;
+
+
+/** Выводит строку таблицы для заданного интегратора.
+ *
+ * @param evaluations Число вычислений угловой скорости на один отрезок.
+ */
+void report (artifical_input_plane_angles_harmonious & input, boost::shared_ptr< integrator<vector3> > integr, int evaluations, long double len) {
+	BOOST_AUTO( data, input.get_input_data() );
+
+	input.set_integrator (integr);
+	long double error = 0;
+	for (int i=0; i<intervals_count; ++i) {
+		long double t1 = len * i,
+			t2 = t1 + len;
+
+		input.set_analytic_increments (false);
+		vector3 value = data->get_integrated (t1, t2);
+
+		input.set_analytic_increments (true);
+		error = std::max (error, distance (value, data->get_integrated (t1, t2)));
+	}
+
+	std::cout << (double) len << '\t' << integr->get_name() << '\t' << evaluations << '\t' << std::scientific << (double) error << std::fixed << std::endl;
+}
+
+
+template <int N>
+void report_gauss_legendre (artifical_input_plane_angles_harmonious & input, long double len) {
+	report (input, boost::shared_ptr< integrator<vector3> > (new gauss_legendre_integrator<vector3,N> ()), N, len);
+}
+
+
+int main() {
+	std::cout.precision (3);
+	std::cout << std::fixed;
+
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
+		plane_angles (PI/2, PI, PI)
+	);
+
+	std::cout << "interval\tmethod\tevaluations\tmax error" << std::endl;
+	for (long double len=0.8; len>0.01; len/=4) {
+		for (int n=10; n<=160; n*=2)
+			report (input, boost::shared_ptr< integrator<vector3> > (new simpson_integrator<vector3> (len / n)), n + 1, len);
+
+		report_gauss_legendre<2> (input, len);
+		report_gauss_legendre<3> (input, len);
+		report_gauss_legendre<4> (input, len);
+		report_gauss_legendre<5> (input, len);
+		report_gauss_legendre<6> (input, len);
+		report_gauss_legendre<7> (input, len);
+		report_gauss_legendre<8> (input, len);
+		report_gauss_legendre<9> (input, len);
+		report_gauss_legendre<10> (input, len);
+	}
+}
@@ -0,0 +1,97 @@
+/** \file magnus_algorithm.cpp
+    \brief Точность и скорость семейства алгоритмов magnus_algorithm (обычных и типа Риккати) при шаговости N = 1..6.
+
+	Для сравнения выводятся и вручную выведенные алгоритмы той же
+	шаговости: метод средней скорости (N=1), method_2step_4degree (N=2) и
+	алгоритм Панова (N=4).
+*/
+#include <iostream>
+#include <string>
+#include "benchmark.hpp"
+#include "../integrator/integrator.hpp"
+#include "../algorithms/magnus_algorithm.hpp"
+#include "../algorithms/old_algorithms/average_speed_algorithm.hpp"
+#include "../algorithms/old_algorithms/method_2step_4degree.hpp"
+#include "../algorithms/old_algorithms/panov_algorithm.hpp"
+#include "../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../types/plane_angles.hpp"
+#include "../utility_functions.hpp"
+
+
+
+//! Время моделирования (в секундах).
+static const long double last_time = 3600;
+
+
+//! Источник входных данных с интегральными данными, заранее посчитанными на сетке с шагом h/N.
+boost::shared_ptr < artifical_input_plane_angles_harmonious > make_source (long double h, int n) {
+	boost::shared_ptr < artifical_input_plane_angles_harmonious > source (new artifical_input_plane_angles_harmonious (
+		plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
+		plane_angles (PI/2, PI, PI)
+	));
+	source->set_integrator (boost::shared_ptr< integrator<vector3> > (new simpson_integrator<vector3> (h / 10)));
+	source->precompute_integrated (h / n, last_time);
+	return source;
+}
+
+
+//! Запускает алгоритм и выводит строку таблицы: ошибку относительно точного решения и время одного шага.
+void report (const std::string & name, int n, algorithm<quaternion,vector3> & alg,
+             artifical_input_plane_angles_harmonious & source, long double h)
+{
+	alg.set_input_data (source.get_input_data());
+	alg.set_step (h);
+	alg.set_last_time (last_time);
+
+	benchmark_timer timer;
+	BOOST_AUTO( output, alg.execute() );
+	double ns = timer.elapsed_ns() / (output->get_count() - 1);
+
+	BOOST_AUTO( exact, source.get_exact_solution (h, last_time) );
+	long double error = 0;
+	for (size_t i=0; i<output->get_count(); ++i)
+		error = std::max (error, distance ((*output)[i], (*exact)[i]));
+
+	std::cout << name << '\t' << n << '\t' << std::fixed << (double) h << '\t' << std::scientific << (double) error
+		<< '\t' << std::fixed << ns << std::endl;
+}
+
+
+//! Выводит строки таблицы для обычного алгоритма и алгоритма типа Риккати с шаговостью N.
+template <int N>
+void report_magnus (long double h) {
+	BOOST_AUTO( source, make_source (h, N) );
+	magnus_algorithm<N> plain;
+	magnus_riccati_algorithm<N> riccati;
+	report ("magnus", N, plain, *source, h);
+	report ("magnus_riccati", N, riccati, *source, h);
+
+	if (N == 1) {
+		average_speed_algorithm<quaternion,vector3> a;
+		report ("average_speed", N, a, *source, h);
+	}
+	if (N == 2) {
+		method_2step_4degree a;
+		report ("method_2step_4degree", N, a, *source, h);
+	}
+	if (N == 4) {
+		panov_algorithm a;
+		report ("panov", N, a, *source, h);
+	}
+}
+
+
+int main() {
+	std::cout.precision (3);
+	std::cout << "algorithm\tN\th\tmax error\tns/step" << std::endl;
+
+	for (long double h=0.1; h>0.04; h/=2) {
+		report_magnus<1> (h);
+		report_magnus<2> (h);
+		report_magnus<3> (h);
+		report_magnus<4> (h);
+		report_magnus<5> (h);
+		report_magnus<6> (h);
+		std::cout << std::endl;
+	}
+}
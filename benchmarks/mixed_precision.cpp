@@ -0,0 +1,99 @@
+/** \file mixed_precision.cpp
+    \brief Сравнение способов накопления ответа (см. iterative_algorithm::set_accumulation()) для алгоритма Панова в double.
+
+	Эталон - тот же алгоритм целиком в long double. Для каждого варианта
+	выводятся ошибка относительно точного решения, максимальное отклонение
+	от эталона и время одного шага. Входные данные считаются один раз в long
+	double и переводятся в double адаптером converted_input_data.
+*/
+#include <iostream>
+#include <string>
+#include "benchmark.hpp"
+#include "../integrator/integrator.hpp"
+#include "../algorithms/old_algorithms/panov_algorithm.hpp"
+#include "../algorithms/stuff/converted_input_data.hpp"
+#include "../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../types/plane_angles.hpp"
+#include "../utility_functions.hpp"
+
+
+
+//! Время моделирования (в секундах).
+static const long double last_time = 3600;
+
+
+//! Число прогонов, из которых берётся самый быстрый.
+static const int repeats = 3;
+
+
+/** Запускает алгоритм Панова над кватернионами с компонентами типа T и выводит строку таблицы.
+ *
+ * @param exact Точное решение на сетке алгоритма.
+ * @param reference Ответ эталонного алгоритма (или пустой указатель, если эталон запускается сейчас).
+ * @return Ответ алгоритма, переведённый в long double.
+ */
+template <typename T>
+boost::shared_ptr < output_data<quaternion> > report (const std::string & name, accumulation_mode mode,
+	const boost::shared_ptr < input_data<quaternion,vector3> > & input,
+	const boost::shared_ptr < output_data<quaternion> > & exact,
+	const boost::shared_ptr < output_data<quaternion> > & reference,
+	long double h)
+{
+	basic_panov_algorithm<T> alg;
+	alg.set_input_data (boost::shared_ptr < input_data < basic_quaternion<T>, basic_vector3<T> > > (
+		new converted_input_data < basic_quaternion<T>, basic_vector3<T>, quaternion, vector3 > (input)
+	));
+	alg.set_step (h);
+	alg.set_last_time (last_time);
+	alg.set_accumulation (mode);
+
+	algorithm < basic_quaternion<T>, basic_vector3<T> > & base = alg;
+	typename algorithm < basic_quaternion<T>, basic_vector3<T> >::t_output_data_ptr output;
+	double ns = 0;
+	for (int r=0; r<repeats; ++r) {
+		benchmark_timer timer;
+		output = base.execute();
+		double elapsed = timer.elapsed_ns() / (output->get_count() - 1);
+		if (r == 0 || elapsed < ns)
+			ns = elapsed;
+	}
+
+	boost::shared_ptr < output_data<quaternion> > converted (new output_data<quaternion>);
+	long double error = 0, deviation = 0;
+	for (size_t i=0; i<output->get_count(); ++i) {
+		converted->add (output->ts[i], quaternion ((*output)[i]));
+		error = std::max (error, distance ((*converted)[i], (*exact)[i]));
+		if (reference)
+			deviation = std::max (deviation, distance ((*converted)[i], (*reference)[i]));
+	}
+
+	std::cout << name << '\t' << std::fixed << (double) h << '\t' << std::scientific << (double) error
+		<< '\t' << (double) deviation << '\t' << std::fixed << ns << std::endl;
+	return converted;
+}
+
+
+int main() {
+	std::cout.precision (3);
+	std::cout << "variant\th\tmax error\tmax deviation from long double\tns/step" << std::endl;
+
+	for (long double h=0.1; h>0.02; h/=2) {
+		artifical_input_plane_angles_harmonious source (
+			plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
+			plane_angles (PI/2, PI, PI)
+		);
+		source.set_integrator (boost::shared_ptr< integrator<vector3> > (new simpson_integrator<vector3> (h / 10)));
+		source.precompute_integrated (h / 4, last_time);
+
+		BOOST_AUTO( input, source.get_input_data() );
+		BOOST_AUTO( exact, source.get_exact_solution (h, last_time) );
+		boost::shared_ptr < output_data<quaternion> > none;
+
+		BOOST_AUTO( reference, report<long double> ("long double", native_accumulation, input, exact, none, h) );
+		report<double> ("double", native_accumulation, input, exact, reference, h);
+		report<double> ("double + long double accumulator", long_double_accumulation, input, exact, reference, h);
+		report<double> ("double + double-double accumulator", double_double_accumulation, input, exact, reference, h);
+
+		std::cout << std::endl;
+	}
+}
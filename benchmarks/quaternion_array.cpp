@@ -0,0 +1,116 @@
+/** \file quaternion_array.cpp
+    \brief Пакетные операции над траекторией: хранилище по компонентам (quaternion_array) в сравнении с std::vector кватернионов.
+
+	Для каждого типа компонент и длины траектории выводятся объём памяти на
+	один кватернион и время обработки одного элемента для произведения,
+	расстояния и нормирования целой траектории - поэлементно над
+	std::vector и пакетно над basic_quaternion_array. Короткая траектория
+	помещается в кэш; на длинной время определяется в основном
+	пропускной способностью памяти.
+*/
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "../types/quaternion_array.hpp"
+
+
+
+//! Число элементов, обрабатываемых за один прогон (траектория проходится count_total / count раз).
+static const size_t count_total = 1 << 22;
+
+
+//! Число прогонов, из которых берётся самый быстрый.
+static const int repeats = 5;
+
+
+//! Поворот на угол, зависящий от номера элемента i (чтобы данные не были одинаковыми).
+template <typename T>
+basic_quaternion<T> sample (size_t i) {
+	T t = T (i) / 1000;
+	return normalize (basic_quaternion<T> (std::cos (t), std::sin (t), T (0.5) * std::cos (3 * t), T (0.25)));
+}
+
+
+//! Выводит строки таблицы для типа T и траектории из count элементов.
+template <typename T>
+void report (const std::string & type_name, size_t count) {
+	const size_t passes = count_total / count;
+	std::vector< basic_quaternion<T> > aos_a (count), aos_b (count), aos_result (count);
+	basic_quaternion_array<T> soa_a (count), soa_b (count), soa_result;
+	for (size_t i=0; i<count; ++i) {
+		aos_a[i] = sample<T> (i);
+		aos_b[i] = sample<T> (count - i);
+		soa_a.set (i, aos_a[i]);
+		soa_b.set (i, aos_b[i]);
+	}
+	std::vector<T> distances (count);
+
+	double aos_ns[3] = { 0, 0, 0 },
+		soa_ns[3] = { 0, 0, 0 };
+	for (int r=0; r<repeats; ++r) {
+		double ns[6];
+		benchmark_timer timer;
+
+		for (size_t p=0; p<passes; ++p)
+			for (size_t i=0; i<count; ++i)
+				aos_result[i] = aos_a[i] * aos_b[i];
+		ns[0] = timer.elapsed_ns();
+		timer.restart();
+		for (size_t p=0; p<passes; ++p)
+			for (size_t i=0; i<count; ++i)
+				distances[i] = distance (aos_a[i], aos_b[i]);
+		ns[1] = timer.elapsed_ns();
+		timer.restart();
+		for (size_t p=0; p<passes; ++p)
+			for (size_t i=0; i<count; ++i)
+				aos_result[i] = normalize (aos_result[i]);
+		ns[2] = timer.elapsed_ns();
+		benchmark_keep (aos_result[count / 2]);
+		benchmark_keep (distances[count / 2]);
+
+		timer.restart();
+		for (size_t p=0; p<passes; ++p)
+			batch_multiply (soa_a, soa_b, soa_result);
+		ns[3] = timer.elapsed_ns();
+		timer.restart();
+		for (size_t p=0; p<passes; ++p)
+			batch_distance (soa_a, soa_b, distances);
+		ns[4] = timer.elapsed_ns();
+		timer.restart();
+		for (size_t p=0; p<passes; ++p)
+			batch_normalize (soa_result);
+		ns[5] = timer.elapsed_ns();
+		benchmark_keep (soa_result.w[count / 2]);
+		benchmark_keep (distances[count / 2]);
+
+		for (int k=0; k<3; ++k) {
+			if (r == 0 || ns[k] < aos_ns[k])
+				aos_ns[k] = ns[k];
+			if (r == 0 || ns[k + 3] < soa_ns[k])
+				soa_ns[k] = ns[k + 3];
+		}
+	}
+
+	static const char * names[] = { "multiply", "distance", "normalize" };
+	for (int k=0; k<3; ++k)
+		std::cout << type_name << '\t' << count << '\t' << sizeof (basic_quaternion<T>) << '\t' << names[k] << '\t'
+			<< aos_ns[k] / count_total << '\t' << soa_ns[k] / count_total << std::endl;
+}
+
+
+int main() {
+	std::cout.precision (2);
+	std::cout << std::fixed;
+	std::cout << "type\tcount\tbytes/quaternion\toperation\tvector ns/element\tquaternion_array ns/element" << std::endl;
+
+	const size_t counts[] = { 4096, 1 << 20 };
+	for (int c=0; c<2; ++c) {
+		report<long double> ("long double", counts[c]);
+		report<double> ("double", counts[c]);
+		report<float> ("float", counts[c]);
+	}
+
+	return 0;
+}
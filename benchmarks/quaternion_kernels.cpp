@@ -0,0 +1,115 @@
+/** \file quaternion_kernels.cpp
+    \brief Скорость операций над кватернионами: векторные реализации (см. quaternion_simd.hpp) в сравнении с покомпонентными.
+
+	Для каждой операции и типа компонент выводится время одной операции в
+	наносекундах для scalar_quaternion_kernels и quaternion_kernels (какой
+	набор инструкций выбран - зависит от флагов компиляции, например -mavx
+	или -march=native). Независимые операции над массивом показывают
+	пропускную способность; цепочка "ответ = ответ * решение на отрезке"
+	(как в iterative_algorithm::execute()) - задержку произведения.
+*/
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "../types/quaternion.hpp"
+
+
+
+//! Число кватернионов в массиве.
+static const int count = 1024;
+
+
+//! Число проходов по массиву.
+static const int passes = 5000;
+
+
+//! Операции, время которых замеряется.
+enum operation {
+	multiply_operation,
+	conjugate_multiply_operation,
+	normalize_operation,
+	distance_operation,
+	multiply_chain_operation
+};
+
+
+//! Названия операций (в порядке перечисления operation).
+static const char * operation_names[] = { "multiply", "conjugate_multiply", "normalize", "distance", "multiply (chain)" };
+
+
+//! Возвращает время одной операции op (в наносекундах), вычисляемой через класс Kernels.
+template <class Kernels, typename T>
+double measure (operation op, const std::vector< basic_quaternion<T> > & a, const std::vector< basic_quaternion<T> > & b) {
+	std::vector< basic_quaternion<T> > result (count);
+	T sum = 0;
+	basic_quaternion<T> chain (1);
+
+	benchmark_timer timer;
+	for (int p=0; p<passes; ++p) {
+		switch (op) {
+		case multiply_operation:
+			for (int i=0; i<count; ++i)
+				result[i] = Kernels::multiply (a[i], b[i]);
+			break;
+		case conjugate_multiply_operation:
+			for (int i=0; i<count; ++i)
+				result[i] = Kernels::conjugate_multiply (a[i], b[i]);
+			break;
+		case normalize_operation:
+			for (int i=0; i<count; ++i)
+				result[i] = Kernels::normalize (a[i]);
+			break;
+		case distance_operation:
+			for (int i=0; i<count; ++i)
+				sum += Kernels::distance (a[i], b[i]);
+			break;
+		case multiply_chain_operation:
+			for (int i=0; i<count; ++i)
+				chain = Kernels::multiply (chain, b[i]);
+			break;
+		}
+		benchmark_keep (result[p % count]);
+	}
+	double ns = timer.elapsed_ns() / passes / count;
+
+	benchmark_keep (sum);
+	benchmark_keep (chain);
+	return ns;
+}
+
+
+//! Выводит строки таблицы для типа T.
+template <typename T>
+void report (const std::string & type_name) {
+	std::vector< basic_quaternion<T> > a (count), b (count);
+	for (int i=0; i<count; ++i) {
+		for (int c=0; c<4; ++c) {
+			a[i][c] = T (std::rand()) / RAND_MAX - T (0.5);
+			b[i][c] = T (std::rand()) / RAND_MAX - T (0.5);
+		}
+		// единичные множители, чтобы цепочка произведений не уходила в переполнение
+		b[i] = scalar_quaternion_kernels<T>::normalize (b[i]);
+	}
+
+	for (int op=multiply_operation; op<=multiply_chain_operation; ++op) {
+		double scalar_ns = measure < scalar_quaternion_kernels<T> > (operation (op), a, b),
+			kernels_ns = measure < quaternion_kernels<T> > (operation (op), a, b);
+		std::cout << type_name << '\t' << operation_names[op] << '\t' << quaternion_kernels<T>::get_instruction_set()
+			<< '\t' << scalar_ns << '\t' << kernels_ns << '\t' << scalar_ns / kernels_ns << std::endl;
+	}
+}
+
+
+int main() {
+	std::cout.precision (3);
+	std::cout << std::fixed;
+	std::cout << "type\toperation\tkernels\tscalar ns\tkernels ns\tspeedup" << std::endl;
+
+	report<float> ("float");
+	report<double> ("double");
+	report<long double> ("long double");
+
+	return 0;
+}
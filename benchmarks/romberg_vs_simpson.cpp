@@ -0,0 +1,101 @@
+/** \file romberg_vs_simpson.cpp
+    \brief Сравнение числа вычислений угловой скорости и погрешности интегральных данных: метод Ромберга против метода Симпсона с шагом default_integrator_step.
+
+	Входные данные - те же, что и в main.cpp. Эталоном служат интегральные
+	данные, посчитанные в режиме "аналитических приращений" (см. класс
+	artifical_input_plane_angles_harmonious).
+*/
+#include <algorithm>
+#include <iostream>
+#include "../integrator/integrator.hpp"
+#include "../integrator/romberg_integrator.hpp"
+#include "../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../types/plane_angles.hpp"
+
+
+
+/** Интегратор-обёртка, подсчитывающий число вычислений функции другим интегратором.
+ */
+class counting_integrator : public integrator<vector3> {
+
+public:
+
+	explicit counting_integrator (boost::shared_ptr< integrator<vector3> > inner)
+		: inner (inner), evaluations_count (0)
+	{ }
+
+	std::string get_name() {
+		return inner->get_name();
+	}
+
+	vector3 integrate (boost::function < vector3(long double) > f, long double x0, long double x1) {
+		return inner->integrate (counting_function (f, &evaluations_count), x0, x1);
+	}
+
+private:
+
+	struct counting_function {
+		counting_function (boost::function < vector3(long double) > f, long long * count)
+			: f(f), count(count)
+		{ }
+		vector3 operator() (long double x) const {
+			++ *count;
+			return f(x);
+		}
+		boost::function < vector3(long double) > f;
+		long long * count;
+	};
+
+	boost::shared_ptr< integrator<vector3> > inner;
+
+public:
+
+	//! Суммарное число вычислений функции.
+	long long evaluations_count;
+
+};
+
+
+//! Число отрезков, по которым берётся наибольшая погрешность и среднее число вычислений.
+static const int intervals_count = 50;
+
+
+void report (artifical_input_plane_angles_harmonious & input, boost::shared_ptr< integrator<vector3> > integr, long double len) {
+	boost::shared_ptr<counting_integrator> counting (new counting_integrator (integr));
+	input.set_integrator (counting);
+	BOOST_AUTO( data, input.get_input_data() );
+
+	long double error = 0;
+	for (int i=0; i<intervals_count; ++i) {
+		long double t1 = len * i,
+			t2 = t1 + len;
+
+		input.set_analytic_increments (false);
+		vector3 value = data->get_integrated (t1, t2);
+
+		input.set_analytic_increments (true);
+		error = std::max (error, distance (value, data->get_integrated (t1, t2)));
+	}
+
+	std::cout << (double) len << '\t' << integr->get_name() << '\t'
+		<< (double) counting->evaluations_count / intervals_count << '\t'
+		<< std::scientific << (double) error << std::fixed << std::endl;
+}
+
+
+int main() {
+	std::cout.precision (3);
+	std::cout << std::fixed;
+
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
+		plane_angles (PI/2, PI, PI)
+	);
+
+	std::cout << "interval\tmethod\tevaluations per interval\tmax error" << std::endl;
+	for (long double len=0.8; len>0.01; len/=4) {
+		report (input, default_integrator<vector3>(), len);
+		report (input, boost::shared_ptr< integrator<vector3> > (new romberg_integrator<vector3> (1E-12)), len);
+		report (input, boost::shared_ptr< integrator<vector3> > (new romberg_integrator<vector3> (1E-18)), len);
+	}
+}
@@ -0,0 +1,139 @@
+/** \file rotation_functions.cpp
+    \brief Точность и скорость функций перехода к кватерниону поворота (см. rotation_functions.hpp) в сравнении с вычислением через sin/cos/tan.
+
+	Для каждого типа, функции и диапазона длин вектора поворота phi_m
+	выводятся максимальная относительная ошибка и время одного вызова для
+	двух способов: по ряду (rotation_functions<T>) и прямо через std::sin,
+	std::cos и std::tan в типе T. Эталон - std::sin, std::cos и std::tan
+	в long double (так что для long double ошибка - это расхождение
+	способов между собой).
+*/
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "../algorithms/stuff/rotation_functions.hpp"
+
+
+
+//! Число точек в каждом диапазоне.
+static const int points = 4096;
+
+
+//! Число проходов по точкам диапазона при замере времени.
+static const int passes = 500;
+
+
+//! Функции, вычисляемые через std::sin, std::cos и std::tan (как было в алгоритмах до rotation_functions).
+template <typename T>
+struct libm_functions {
+
+	static T half_angle_cos (T phi_m) {
+		return std::cos (phi_m / 2);
+	}
+
+	static T half_angle_sinc (T phi_m) {
+		return std::sin (phi_m / 2) / phi_m;
+	}
+
+	static T quarter_angle_tanc (T phi_m) {
+		return std::tan (phi_m / 4) / phi_m;
+	}
+
+}; // struct libm_functions
+
+
+//! Эталонные значения функций (в long double).
+struct reference_functions {
+
+	static long double half_angle_cos (long double phi_m) {
+		return std::cos (phi_m / 2);
+	}
+
+	static long double half_angle_sinc (long double phi_m) {
+		return std::sin (phi_m / 2) / phi_m;
+	}
+
+	static long double quarter_angle_tanc (long double phi_m) {
+		return std::tan (phi_m / 4) / phi_m;
+	}
+
+}; // struct reference_functions
+
+
+//! Одна из трёх функций класса F, выбранная номером function.
+template <class F, typename T>
+inline T call (int function, T phi_m) {
+	switch (function) {
+	case 0:
+		return F::half_angle_cos (phi_m);
+	case 1:
+		return F::half_angle_sinc (phi_m);
+	default:
+		return F::quarter_angle_tanc (phi_m);
+	}
+}
+
+
+/** Замеряет максимальную относительную ошибку и время одного вызова (в наносекундах) функции класса F.
+ *
+ * Функция выбирается вне цикла замера, так что switch в call() компилятор
+ * выносит из цикла.
+ */
+template <class F, typename T>
+void measure (int function, const std::vector<T> & angles, long double & error, double & ns) {
+	error = 0;
+	for (size_t i=0; i<angles.size(); ++i) {
+		long double reference = call<reference_functions> (function, (long double) angles[i]);
+		error = std::max (error, std::fabs ((long double) call<F> (function, angles[i]) / reference - 1));
+	}
+
+	benchmark_timer timer;
+	T sum = 0;
+	for (int p=0; p<passes; ++p)
+		for (size_t i=0; i<angles.size(); ++i)
+			sum += call<F> (function, angles[i]);
+	ns = timer.elapsed_ns() / passes / angles.size();
+	benchmark_keep (sum);
+}
+
+
+//! Выводит строки таблицы для типа T.
+template <typename T>
+void report (const std::string & type_name) {
+	static const char * functions[] = { "cos(phi/2)", "sin(phi/2)/phi", "tan(phi/4)/phi" };
+	static const long double ranges[][2] = { { 0, 1E-3L }, { 1E-3L, 0.05L }, { 0.05L, 0.5L }, { 0.5L, 1 } };
+
+	for (size_t r=0; r<sizeof (ranges) / sizeof (ranges[0]); ++r) {
+		std::vector<T> angles (points);
+		for (int i=0; i<points; ++i)
+			angles[i] = T (ranges[r][0] + (ranges[r][1] - ranges[r][0]) * (i + 1) / points);
+
+		for (int f=0; f<3; ++f) {
+			long double series_error, libm_error;
+			double series_ns, libm_ns;
+			measure < rotation_functions<T> > (f, angles, series_error, series_ns);
+			measure < libm_functions<T> > (f, angles, libm_error, libm_ns);
+
+			std::cout.unsetf (std::ios::floatfield);
+			std::cout << type_name << '\t' << functions[f] << '\t'
+				<< (double) ranges[r][0] << ".." << (double) ranges[r][1] << '\t'
+				<< std::scientific << (double) series_error << '\t' << (double) libm_error << '\t'
+				<< std::fixed << series_ns << '\t' << libm_ns << std::endl;
+		}
+	}
+}
+
+
+int main() {
+	std::cout.precision (2);
+	std::cout << "type\tfunction\tphi_m\tseries error\tlibm error\tseries ns\tlibm ns" << std::endl;
+
+	report<float> ("float");
+	report<double> ("double");
+	report<long double> ("long double");
+
+	return 0;
+}
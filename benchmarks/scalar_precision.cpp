@@ -0,0 +1,86 @@
+/** \file scalar_precision.cpp
+    \brief Сравнение точности и скорости алгоритмов при разных скалярных типах (long double, double, float).
+
+	Входные данные считаются один раз в long double (см.
+	artifical_input::precompute_integrated()) и переводятся в нужный тип
+	адаптером converted_input_data, так что различие в ошибке вызвано только
+	арифметикой самого алгоритма. Ошибка считается относительно точного
+	решения в long double.
+*/
+#include <iostream>
+#include <string>
+#include "benchmark.hpp"
+#include "../integrator/integrator.hpp"
+#include "../algorithms/old_algorithms/panov_algorithm.hpp"
+#include "../algorithms/old_algorithms/panov_riccati_algorithm.hpp"
+#include "../algorithms/stuff/converted_input_data.hpp"
+#include "../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../types/plane_angles.hpp"
+#include "../utility_functions.hpp"
+
+
+
+//! Время моделирования (в секундах).
+static const long double last_time = 3600;
+
+
+/** Запускает алгоритм над кватернионами с компонентами типа T и выводит его ошибку и время одного шага.
+ *
+ * @param input Источник входных данных (в long double).
+ * @param exact Точное решение на сетке алгоритма.
+ */
+template <typename T>
+void report (const std::string & name, algorithm< basic_quaternion<T>, basic_vector3<T> > & alg,
+             const boost::shared_ptr < input_data<quaternion,vector3> > & input,
+             const boost::shared_ptr < output_data<quaternion> > & exact,
+             long double h)
+{
+	alg.set_input_data (boost::shared_ptr < input_data < basic_quaternion<T>, basic_vector3<T> > > (
+		new converted_input_data < basic_quaternion<T>, basic_vector3<T>, quaternion, vector3 > (input)
+	));
+	alg.set_step (h);
+	alg.set_last_time (last_time);
+
+	benchmark_timer timer;
+	BOOST_AUTO( output, alg.execute() );
+	double ns = timer.elapsed_ns() / (output->get_count() - 1);
+
+	long double difference = 0;
+	for (size_t i=0; i<output->get_count(); ++i)
+		difference = std::max (difference, distance (quaternion ((*output)[i]), (*exact)[i]));
+
+	std::cout << name << '\t' << std::fixed << (double) h << '\t' << std::scientific << (double) difference
+		<< '\t' << std::fixed << ns << std::endl;
+}
+
+
+int main() {
+	std::cout.precision (3);
+	std::cout << "algorithm\th\tmax error\tns/step" << std::endl;
+
+	for (long double h=0.1; h>0.02; h/=2) {
+		artifical_input_plane_angles_harmonious source (
+			plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
+			plane_angles (PI/2, PI, PI)
+		);
+		source.set_integrator (boost::shared_ptr< integrator<vector3> > (new simpson_integrator<vector3> (h / 10)));
+		source.precompute_integrated (h / 4, last_time);
+
+		BOOST_AUTO( input, source.get_input_data() );
+		BOOST_AUTO( exact, source.get_exact_solution (h, last_time) );
+
+		basic_panov_algorithm<long double> panov_ld;
+		basic_panov_algorithm<double> panov_d;
+		basic_panov_algorithm<float> panov_f;
+		report ("panov<long double>", panov_ld, input, exact, h);
+		report ("panov<double>", panov_d, input, exact, h);
+		report ("panov<float>", panov_f, input, exact, h);
+
+		basic_panov_riccati_algorithm<long double> riccati_ld;
+		basic_panov_riccati_algorithm<double> riccati_d;
+		report ("panov_riccati<long double>", riccati_ld, input, exact, h);
+		report ("panov_riccati<double>", riccati_d, input, exact, h);
+
+		std::cout << std::endl;
+	}
+}
@@ -0,0 +1,97 @@
+/** \file skew33.cpp
+    \brief Скорость вычисления вектора поворота алгоритма Панова: через кососимметричные матрицы skew33 в сравнении с matrix33.
+
+	Для каждого типа компонент выводится время одного вызова
+	panov_rotation_vector() (в наносекундах) в текущем виде (skew33) и в
+	прежнем - с матрицами Gamma[j] общего вида, а также максимальное
+	расхождение результатов (ожидается ноль).
+*/
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "../algorithms/old_algorithms/panov_algorithm.hpp"
+#include "../types/matrix33.hpp"
+
+
+
+//! Число наборов входных данных.
+static const int count = 1024;
+
+
+//! Число проходов по наборам.
+static const int passes = 500;
+
+
+//! Вектор поворота алгоритма Панова через матрицы общего вида (как было до skew33).
+template <typename T>
+basic_vector3<T> matrix_rotation_vector (const std::vector< basic_vector3<T> > & gamma) {
+	typedef basic_matrix33<T> t_matrix;
+
+	t_matrix Gamma[4];
+	for (int j=0; j<4; ++j) {
+		const basic_vector3<T> & g = gamma[j];
+		Gamma[j] = t_matrix (
+			    0,   -g[2],    g[1],
+			 g[2],       0,   -g[0],
+			-g[1],    g[0],       0
+		);
+	}
+
+	basic_vector3<T> phi =
+		22.0/45 * (Gamma[0] + Gamma[1]) * (gamma[2] + gamma[3]) +
+		32.0/45 * (Gamma[0] * gamma[1] + Gamma[2] * gamma[3]);
+
+	basic_vector3<T> delta_phi =
+		32.0/45 * (Gamma[0]*Gamma[1]*gamma[3] - Gamma[3]*Gamma[0]*gamma[2]) +
+		64.0/45 * dotProduct (gamma[1], gamma[2]) * Gamma[1] * gamma[2];
+
+	for (int j=0; j<4; ++j)
+		phi += gamma[j];
+	phi += delta_phi;
+
+	return phi;
+}
+
+
+//! Выводит строку таблицы для типа T.
+template <typename T>
+void report (const std::string & type_name) {
+	std::vector< std::vector< basic_vector3<T> > > inputs (count, std::vector< basic_vector3<T> > (4));
+	for (int i=0; i<count; ++i)
+		for (int j=0; j<4; ++j)
+			for (int c=0; c<3; ++c)
+				inputs[i][j][c] = T (0.01) * (2 * T (std::rand()) / RAND_MAX - 1);
+
+	T max_difference = 0;
+	for (int i=0; i<count; ++i)
+		max_difference = std::max (max_difference, distance (panov_rotation_vector (inputs[i]), matrix_rotation_vector (inputs[i])));
+
+	benchmark_timer matrix_timer;
+	for (int p=0; p<passes; ++p)
+		for (int i=0; i<count; ++i)
+			benchmark_keep (matrix_rotation_vector (inputs[i]));
+	double matrix_ns = matrix_timer.elapsed_ns() / passes / count;
+
+	benchmark_timer skew_timer;
+	for (int p=0; p<passes; ++p)
+		for (int i=0; i<count; ++i)
+			benchmark_keep (panov_rotation_vector (inputs[i]));
+	double skew_ns = skew_timer.elapsed_ns() / passes / count;
+
+	std::cout << type_name << '\t' << matrix_ns << '\t' << skew_ns << '\t' << matrix_ns / skew_ns << '\t' << max_difference << std::endl;
+}
+
+
+int main() {
+	std::cout.precision (3);
+	std::cout << "type\tmatrix33 ns\tskew33 ns\tspeedup\tmax difference" << std::endl;
+
+	report<float> ("float");
+	report<double> ("double");
+	report<long double> ("long double");
+
+	return 0;
+}
@@ -0,0 +1,135 @@
+/** \file static_integration.cpp
+    \brief Сравнение накладных расходов на одно вычисление подынтегральной функции: виртуальный интегратор с boost::function против правил интегрирования со статической диспетчеризацией (см. integration_rules.hpp).
+
+	Замеряется два случая: тривиальная подынтегральная функция (чистые
+	накладные расходы вызова) и угловая скорость из main.cpp.
+*/
+#include <iostream>
+#include "benchmark.hpp"
+#include "../integrator/integrator.hpp"
+#include "../integrator/integration_rules.hpp"
+#include "../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../types/plane_angles.hpp"
+
+
+
+//! Тривиальная подынтегральная функция.
+struct linear_function {
+	vector3 operator() (long double x) const {
+		return vector3 (x, 2 * x, 3 * x);
+	}
+};
+
+//! Обёртка, подсчитывающая число вычислений функции.
+template <class F>
+struct counting_function {
+	F f;
+	int * count;
+	vector3 operator() (long double x) const {
+		++ *count;
+		return f(x);
+	}
+};
+
+
+//! Число отрезков интегрирования в каждом замере.
+static const int intervals_count = 20000;
+//! Длина отрезка интегрирования.
+static const long double interval = 0.05;
+
+
+//! Возвращает среднее время на одно вычисление функции (в наносекундах) при интегрировании через виртуальный интегратор.
+template <class F>
+double measure_virtual (integrator<vector3> & integr, F f, int evaluations) {
+	boost::function < vector3(long double) > func (f);
+	vector3 sum;
+	benchmark_timer timer;
+	for (int i=0; i<intervals_count; ++i)
+		sum += integr.integrate (func, interval * i, interval * (i + 1));
+	double ns = timer.elapsed_ns();
+	benchmark_keep (sum);
+	return ns / intervals_count / evaluations;
+}
+
+//! Возвращает среднее время на одно вычисление функции (в наносекундах) при интегрировании по правилу.
+template <class Rule, class F>
+double measure_static (const Rule & rule, F f, int evaluations) {
+	vector3 sum;
+	benchmark_timer timer;
+	for (int i=0; i<intervals_count; ++i)
+		sum += integrate<vector3> (rule, f, interval * i, interval * (i + 1));
+	double ns = timer.elapsed_ns();
+	benchmark_keep (sum);
+	return ns / intervals_count / evaluations;
+}
+
+//! Возвращает среднее время на одно вычисление функции (в наносекундах) при интегрировании через input_data (как это делают алгоритмы).
+double measure_input_data (artifical_input<quaternion,vector3> & input, int evaluations) {
+	BOOST_AUTO( data, input.get_input_data() );
+	vector3 sum;
+	benchmark_timer timer;
+	for (int i=0; i<intervals_count; ++i)
+		sum += data->get_integrated (interval * i, interval * (i + 1));
+	double ns = timer.elapsed_ns();
+	benchmark_keep (sum);
+	return ns / intervals_count / evaluations;
+}
+
+//! Возвращает среднее время на одно вычисление функции (в наносекундах) при интегрировании по правилу с встроенной угловой скоростью.
+template <class Rule>
+double measure_integrate_omega (artifical_input_plane_angles_harmonious & input, const Rule & rule, int evaluations) {
+	vector3 sum;
+	benchmark_timer timer;
+	for (int i=0; i<intervals_count; ++i)
+		sum += input.integrate_omega (rule, interval * i, interval * (i + 1));
+	double ns = timer.elapsed_ns();
+	benchmark_keep (sum);
+	return ns / intervals_count / evaluations;
+}
+
+
+//! Возвращает число вычислений функции при интегрировании по правилу rule на одном отрезке.
+template <class Rule>
+int count_evaluations (const Rule & rule) {
+	int count = 0;
+	counting_function<linear_function> f = { linear_function(), &count };
+	integrate<vector3> (rule, f, 0, interval);
+	return count;
+}
+
+
+template <class Rule, class Integrator>
+void report (const char * name, const Rule & rule, Integrator & integr, artifical_input_plane_angles_harmonious & input) {
+	int evaluations = count_evaluations (rule);
+
+	double virtual_trivial = measure_virtual (integr, linear_function(), evaluations),
+		static_trivial = measure_static (rule, linear_function(), evaluations);
+
+	input.set_integrator (boost::shared_ptr< integrator<vector3> > (new Integrator (integr)));
+	double virtual_omega = measure_input_data (input, evaluations),
+		static_omega = measure_integrate_omega (input, rule, evaluations);
+
+	std::cout << name << '\t' << evaluations << '\t'
+		<< virtual_trivial << '\t' << static_trivial << '\t'
+		<< virtual_omega << '\t' << static_omega << std::endl;
+}
+
+
+int main() {
+	std::cout.precision (2);
+	std::cout << std::fixed;
+
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
+		plane_angles (PI/2, PI, PI)
+	);
+
+	std::cout << "ns per evaluation" << std::endl;
+	std::cout << "method\tevaluations\ttrivial, virtual\ttrivial, static\tomega, virtual\tomega, static" << std::endl;
+
+	simpson_integrator<vector3> simpson (interval / 10);
+	report ("simpson", simpson_rule (interval / 10), simpson, input);
+
+	gauss_legendre_integrator<vector3,5> gauss;
+	report ("gauss-legendre 5", gauss_legendre_rule<5>(), gauss, input);
+}
@@ -0,0 +1,114 @@
+/** \file static_iterative_algorithm.cpp
+    \brief Сравнение стоимости одного шага итеративных алгоритмов: виртуальная реализация (iterative_algorithm) против статической (static_iterative_algorithm).
+
+	Чтобы измерялась стоимость самого алгоритма, а не интегрирования, входные
+	данные берутся из простого источника, возвращающего заранее посчитанные
+	приращения (см. class fixed_input_data).
+*/
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "../algorithms/old_algorithms/average_speed_algorithm.hpp"
+#include "../algorithms/old_algorithms/method_2step_4degree.hpp"
+#include "../algorithms/old_algorithms/panov_algorithm.hpp"
+#include "../algorithms/old_algorithms/panov_riccati_algorithm.hpp"
+#include "../utility_functions.hpp"
+
+
+
+//! Источник входных данных, возвращающий на каждом отрезке одно из заранее заданных приращений (по кругу).
+class fixed_input_data : public input_data<quaternion,vector3> {
+
+public:
+
+	fixed_input_data() {
+		for (int i=0; i<64; ++i)
+			increments_.push_back (vector3 (1E-3 * sin (0.1 * i), 2E-3 * cos (0.3 * i), 1E-3));
+	}
+
+	virtual quaternion get_initial_solution() {
+		return quaternion (1);
+	}
+
+	virtual void get_integrated_range (long double, long double, size_t count, std::vector<vector3> & result) {
+		result.resize (count);
+		for (size_t k=0; k<count; ++k)
+			result[k] = increments_[k % increments_.size()];
+	}
+
+private:
+	std::vector<vector3> increments_;
+
+}; // class fixed_input_data
+
+
+//! Число шагов одного прогона.
+static const int steps = 200000;
+
+
+//! Число прогонов, из которых берётся самый быстрый.
+static const int repeats = 7;
+
+
+//! Запускает алгоритм несколько раз и возвращает среднее время одного шага в самом быстром прогоне (в наносекундах).
+long double measure (algorithm<quaternion,vector3> & alg, boost::shared_ptr < output_data<quaternion> > & output) {
+	alg.set_input_data (boost::shared_ptr < input_data<quaternion,vector3> > (new fixed_input_data));
+	alg.set_step (1);
+	alg.set_last_time (steps);
+
+	long double best = 0;
+	for (int r=0; r<repeats; ++r) {
+		benchmark_timer timer;
+		output = alg.execute();
+		long double ns = timer.elapsed_ns();
+		benchmark_keep ((*output)[steps]);
+
+		if (r == 0 || ns < best)
+			best = ns;
+	}
+	return best / steps;
+}
+
+
+//! Выводит строку таблицы для пары "виртуальный алгоритм - статический алгоритм".
+void report (const std::string & name, algorithm<quaternion,vector3> & virtual_alg, algorithm<quaternion,vector3> & static_alg) {
+	boost::shared_ptr < output_data<quaternion> > virtual_output, static_output;
+	long double virtual_ns = measure (virtual_alg, virtual_output);
+	long double static_ns = measure (static_alg, static_output);
+
+	long double difference = 0;
+	for (size_t i=0; i<virtual_output->get_count(); ++i)
+		difference = std::max (difference, distance ((*virtual_output)[i], (*static_output)[i]));
+
+	std::cout << name << '\t' << std::fixed << (double) virtual_ns << '\t' << (double) static_ns << '\t'
+		<< (double) (virtual_ns / static_ns) << '\t' << std::scientific << (double) difference << std::endl;
+}
+
+
+int main() {
+	std::cout.precision (3);
+
+	std::cout << "algorithm\tvirtual, ns/step\tstatic, ns/step\tspeedup\tmax difference" << std::endl;
+	{
+		average_speed_algorithm<quaternion,vector3> a;
+		static_average_speed_algorithm<quaternion,vector3> b;
+		report ("average_speed", a, b);
+	}
+	{
+		method_2step_4degree a;
+		static_method_2step_4degree b;
+		report ("method_2step_4degree", a, b);
+	}
+	{
+		panov_algorithm a;
+		static_panov_algorithm b;
+		report ("panov", a, b);
+	}
+	{
+		panov_riccati_algorithm a;
+		static_panov_riccati_algorithm b;
+		report ("panov_riccati", a, b);
+	}
+}
@@ -0,0 +1,82 @@
+/** \file stream_latency.cpp
+    \brief Задержка одного обновления итеративных алгоритмов в потоковом режиме (см. iterative_algorithm::start_stream()).
+
+	Обновление - это передача входных данных на всех подотрезках одного
+	шага (их число равно шаговости алгоритма) и получение текущего ответа.
+	Для каждого алгоритма выводятся медиана (p50), 99-й процентиль (p99) и
+	максимум времени обновления в наносекундах.
+*/
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "../algorithms/old_algorithms/average_speed_algorithm.hpp"
+#include "../algorithms/old_algorithms/average_speed_riccati_algorithm.hpp"
+#include "../algorithms/old_algorithms/method_2step_4degree.hpp"
+#include "../algorithms/old_algorithms/method_2step_4degree_riccati.hpp"
+#include "../algorithms/old_algorithms/method_2step_4degree_riccati_2.hpp"
+#include "../algorithms/old_algorithms/panov_4degree_algorithm.hpp"
+#include "../algorithms/old_algorithms/panov_algorithm.hpp"
+#include "../algorithms/old_algorithms/panov_riccati_algorithm.hpp"
+
+
+
+//! Число замеряемых обновлений.
+static const int updates = 200000;
+
+
+//! Шаговость алгоритма, определённая по числу подотрезков до первого обновления ответа.
+template <typename Q, typename I>
+int detect_steps_count (iterative_algorithm<Q,I> & alg, const I & increment) {
+	alg.start_stream (Q(1));
+	int count = 1;
+	while (! alg.push_increment (increment))
+		++count;
+	return count;
+}
+
+
+//! Замеряет время обновлений алгоритма и выводит строку таблицы.
+template <typename Q, typename I>
+void report (const std::string & name, iterative_algorithm<Q,I> & alg) {
+	std::vector<I> increments;
+	for (int i=0; i<64; ++i)
+		increments.push_back (I (vector3 (1E-3 * sin (0.1 * i), 2E-3 * cos (0.3 * i), 1E-3)));
+
+	alg.set_step (0.01);
+	int steps_count = detect_steps_count (alg, increments[0]);
+	alg.start_stream (Q(1));
+
+	std::vector<double> ns (updates);
+	size_t next = 0;
+	for (int u=0; u<updates; ++u) {
+		benchmark_timer timer;
+		for (int j=0; j<steps_count; ++j) {
+			alg.push_increment (increments[next]);
+			next = (next + 1) % increments.size();
+		}
+		benchmark_keep (alg.get_orientation());
+		ns[u] = timer.elapsed_ns();
+	}
+
+	std::sort (ns.begin(), ns.end());
+	std::cout << name << '\t' << steps_count << '\t' << std::fixed << ns[updates / 2] << '\t'
+		<< ns[updates * 99 / 100] << '\t' << ns.back() << std::endl;
+}
+
+
+int main() {
+	std::cout.precision (1);
+	std::cout << "algorithm\tsteps\tp50, ns\tp99, ns\tmax, ns" << std::endl;
+
+	{ average_speed_algorithm<quaternion,vector3> a;  report ("average_speed", a); }
+	{ average_speed_riccati_algorithm<quaternion,vector3> a;  report ("average_speed_riccati", a); }
+	{ method_2step_4degree a;  report ("method_2step_4degree", a); }
+	{ method_2step_4degree_riccati a;  report ("method_2step_4degree_riccati", a); }
+	{ method_2step_4degree_riccati_2 a;  report ("method_2step_4degree_riccati_2", a); }
+	{ panov_4degree_algorithm a;  report ("panov_4degree", a); }
+	{ panov_algorithm a;  report ("panov", a); }
+	{ panov_riccati_algorithm a;  report ("panov_riccati", a); }
+	{ basic_panov_algorithm<double> a;  report ("panov<double>", a); }
+}
@@ -0,0 +1,141 @@
+/** \file adaptive_simpson_integrator.hpp
+    \brief Содержит класс интегратора с помощью адаптивного метода Симпсона (с контролем погрешности).
+*/
+
+#pragma once
+#ifndef INTEGRATOR_ADAPTIVE_SIMPSON_INTEGRATOR_H
+#define INTEGRATOR_ADAPTIVE_SIMPSON_INTEGRATOR_H
+
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "integrator.hpp"
+#include "../utility_functions.hpp"
+
+
+
+/** Класс для интегратора по адаптивному методу Симпсона.
+ *
+ * Отрезок интегрирования делится пополам до тех пор, пока оценка
+ * погрешности на каждом куске (разность формулы Симпсона на куске и суммы
+ * формул на его половинах) не станет меньше отведённой куску доли допуска.
+ * Значения функции, посчитанные на предыдущих уровнях деления, используются
+ * повторно, так что каждое деление стоит ровно двух новых вычислений функции.
+ *
+ * Допуск задаётся абсолютный и относительный (относительно модуля всего
+ * интеграла); используется больший из них. Расстояние между значениями
+ * типа T вычисляется функцией distance(). Допуск куска не опускается ниже
+ * нескольких единиц последнего разряда long double от модуля формулы на
+ * этом куске: иначе при интеграле, близком к нулю, деление шло бы до
+ * max_depth из-за ошибок округления.
+ *
+ * Число вычислений функции, потраченных на последний вызов integrate(),
+ * можно узнать методом get_evaluations_count().
+ */
+template <class T>
+class adaptive_simpson_integrator : public integrator<T> {
+
+public:
+
+	/** Конструктор, принимает в качестве параметров допуски на погрешность.
+	 *
+	 * \param absolute_tolerance абсолютный допуск на погрешность интеграла
+	 * \param relative_tolerance относительный допуск на погрешность интеграла
+	 * \param max_depth наибольшая глубина деления отрезка пополам
+	 *
+	 * @throws std::invalid_argument Если допуски отрицательны или оба равны нулю, либо max_depth меньше единицы.
+	 */
+	adaptive_simpson_integrator (long double absolute_tolerance, long double relative_tolerance = 0, int max_depth = 20)
+		: absolute_tolerance (absolute_tolerance),
+		  relative_tolerance (relative_tolerance),
+		  max_depth (max_depth),
+		  evaluations_count (0)
+	{
+		if (absolute_tolerance < 0 || relative_tolerance < 0 || (absolute_tolerance == 0 && relative_tolerance == 0))
+			throw std::invalid_argument ("Допуск на погрешность должен быть положительным.");
+		if (max_depth < 1)
+			throw std::invalid_argument ("Глубина деления отрезка должна быть положительной.");
+	}
+
+	//! Возвращает название метода
+	std::string get_name() {
+		std::ostringstream oss;
+		oss << "Адаптивный метод Симпсона (абс. допуск = " << absolute_tolerance << ", отн. допуск = " << relative_tolerance << ")";
+		return oss.str();
+	}
+
+	//! Выполняет численное интегрирование и возвращает результат
+	T integrate (boost::function < T(long double) > f, long double x0, long double x1) {
+		evaluations_count = 3;
+		long double xm = (x0 + x1) / 2;
+		T f0 = f(x0),
+			fm = f(xm),
+			f1 = f(x1);
+		T whole = (f0 + fm * 4 + f1) * ((x1 - x0) / 6);
+
+		long double tolerance = std::max (absolute_tolerance, relative_tolerance * distance (whole, T()));
+		T result = integrate_ (f, x0, x1, f0, fm, f1, whole, tolerance, 0);
+		this->count_ (1, evaluations_count);
+		return result;
+	}
+
+	//! Возвращает число вычислений функции, потраченных на последний вызов integrate().
+	int get_evaluations_count() const {
+		return evaluations_count;
+	}
+
+protected:
+
+	//! параметр метода - абсолютный допуск на погрешность
+	long double absolute_tolerance;
+	//! параметр метода - относительный допуск на погрешность
+	long double relative_tolerance;
+	//! параметр метода - наибольшая глубина деления отрезка пополам
+	int max_depth;
+	//! число вычислений функции в последнем вызове integrate()
+	int evaluations_count;
+
+private:
+
+	/** Рекурсивно интегрирует функцию на отрезке [x0;x1].
+	 *
+	 * @param f0,fm,f1 Уже посчитанные значения функции на концах и в середине отрезка.
+	 * @param whole Формула Симпсона на всём отрезке.
+	 * @param tolerance Допуск на погрешность, отведённый этому отрезку.
+	 * @param depth Текущая глубина деления.
+	 */
+	T integrate_ (const boost::function < T(long double) > & f, long double x0, long double x1,
+		const T & f0, const T & fm, const T & f1, const T & whole, long double tolerance, int depth)
+	{
+		long double xm = (x0 + x1) / 2,
+			xl = (x0 + xm) / 2,
+			xr = (xm + x1) / 2;
+		T fl = f(xl),
+			fr = f(xr);
+		evaluations_count += 2;
+
+		T left = (f0 + fl * 4 + fm) * ((xm - x0) / 6),
+			right = (fm + fr * 4 + f1) * ((x1 - xm) / 6);
+		T halves = left + right;
+
+		// погрешность формулы на половинах примерно в 15 раз меньше их разности с формулой на всём отрезке;
+		// первое деление выполняется всегда, чтобы не принять за ответ случайное совпадение
+		T correction = (halves - whole) * (1.0 / 15);
+		long double rounding_tolerance = 64 * std::numeric_limits<long double>::epsilon() * distance (whole, T());
+		if ((depth > 0 && distance (correction, T()) <= std::max (tolerance, rounding_tolerance)) || depth >= max_depth)
+			return halves + correction;
+
+		return integrate_ (f, x0, xm, f0, fl, fm, left, tolerance / 2, depth + 1)
+			+ integrate_ (f, xm, x1, fm, fr, f1, right, tolerance / 2, depth + 1);
+	}
+
+}; // class adaptive_simpson_integrator
+
+
+
+#endif // ifndef INTEGRATOR_ADAPTIVE_SIMPSON_INTEGRATOR_H
@@ -0,0 +1,96 @@
+/** \file gauss_legendre_integrator.hpp
+    \brief Содержит класс интегратора с помощью квадратурной формулы Гаусса-Лежандра.
+*/
+
+#pragma once
+#ifndef INTEGRATOR_GAUSS_LEGENDRE_INTEGRATOR_H
+#define INTEGRATOR_GAUSS_LEGENDRE_INTEGRATOR_H
+
+
+
+#include <sstream>
+#include <string>
+#include "integrator.hpp"
+#include "integration_rules.hpp"
+
+
+
+/** Класс для интегратора по квадратурной формуле Гаусса-Лежандра с N узлами.
+ *
+ * Формула точна для многочленов степени до 2N-1, поэтому для гладких
+ * функций даёт на порядки меньшую погрешность, чем метод Симпсона с тем же
+ * числом вычислений функции. Узлы и веса берутся из таблицы
+ * gauss_legendre_table<N>, известной на этапе компиляции. Само вычисление
+ * выполняется правилом gauss_legendre_rule<N>.
+ *
+ * Если задан шаг h, то отрезок интегрирования предварительно делится на
+ * равные куски длины не более h, и формула применяется к каждому из них.
+ *
+ * @tparam T Тип значения, возвращаемого функцией.
+ * @tparam N Число узлов формулы (от 1 до 10).
+ */
+template <class T, int N>
+class gauss_legendre_integrator : public integrator<T> {
+
+public:
+
+	//! Конструктор, принимает в качестве параметра наибольшую длину куска
+	/** \param h наибольшая длина куска, к которому применяется формула (если h не положительно, то формула применяется ко всему отрезку)
+	*/
+	gauss_legendre_integrator (long double h = 0)
+		: h(h)
+	{ }
+
+	//! Возвращает название метода
+	std::string get_name() {
+		std::ostringstream oss;
+		oss << "Метод Гаусса-Лежандра (число узлов = " << N;
+		if (h > 0)
+			oss << ", шаг = " << h;
+		oss << ")";
+		return oss.str();
+	}
+
+	//! Выполняет численное интегрирование и возвращает результат
+	T integrate (boost::function < T(long double) > f, long double x0, long double x1) {
+		gauss_legendre_rule<N> rule (h);
+		this->count_ (1, rule.pieces_count (x1 - x0) * N);
+		return rule.template integrate<T> (f, x0, x1);
+	}
+
+	//! Выполняет численное интегрирование пакетной функции, вычисляя её во всех узлах одним вызовом
+	T integrate_batch (typename integrator<T>::t_batch_function f, long double x0, long double x1) {
+		integration_workspace<T> workspace;
+		return integrate_batch (f, x0, x1, workspace);
+	}
+
+	//! Выполняет численное интегрирование пакетной функции на каждом из count подряд идущих отрезков длины step, вычисляя её во всех узлах одним вызовом
+	void integrate_range_batch (typename integrator<T>::t_batch_function f, long double x0, long double step, size_t count, std::vector<T> & result) {
+		integration_workspace<T> workspace;
+		integrate_range_batch (f, x0, step, count, result, workspace);
+	}
+
+	//! То же, что integrate_batch(), но узлы и значения функции хранятся в рабочих массивах workspace
+	T integrate_batch (typename integrator<T>::t_batch_function f, long double x0, long double x1, integration_workspace<T> & workspace) {
+		gauss_legendre_rule<N> rule (h);
+		this->count_ (1, rule.pieces_count (x1 - x0) * N);
+		return rule.template integrate_batch<T> (f, x0, x1, workspace);
+	}
+
+	//! То же, что integrate_range_batch(), но узлы и значения функции хранятся в рабочих массивах workspace
+	void integrate_range_batch (typename integrator<T>::t_batch_function f, long double x0, long double step, size_t count, std::vector<T> & result, integration_workspace<T> & workspace) {
+		gauss_legendre_rule<N> rule (h);
+		this->count_ (count, count * rule.pieces_count (step) * N);
+		rule.template integrate_range_batch<T> (f, x0, step, count, result, workspace);
+	}
+
+protected:
+
+	//! параметр метода - h - наибольшая длина куска
+	long double h;
+
+}; // class gauss_legendre_integrator
+
+
+
+#endif // ifndef INTEGRATOR_GAUSS_LEGENDRE_INTEGRATOR_H
@@ -0,0 +1,288 @@
+/** \file gauss_legendre_table.hpp
+    \brief Содержит таблицы узлов и весов квадратурных формул Гаусса-Лежандра (см. класс gauss_legendre_integrator).
+*/
+
+#pragma once
+#ifndef INTEGRATOR_GAUSS_LEGENDRE_TABLE_H
+#define INTEGRATOR_GAUSS_LEGENDRE_TABLE_H
+
+
+
+/** Таблица узлов и весов квадратурной формулы Гаусса-Лежандра по N узлам на отрезке [-1;1].
+ *
+ * Таблицы заданы для N от 1 до 10 константами long double (узлы - корни
+ * многочлена Лежандра P_N, найденные методом Ньютона в 60-значной
+ * арифметике; веса - 2 / ((1 - x^2) P_N'(x)^2)), поэтому полностью
+ * известны на этапе компиляции. Узлы перечислены в порядке возрастания.
+ *
+ * Для других N таблица не определена, и попытка её использовать приведёт к
+ * ошибке компиляции.
+ */
+template <int N>
+struct gauss_legendre_table;
+
+
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 1 узлу.
+template <>
+struct gauss_legendre_table<1> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			 0.0000000000000000000000000L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 2.0000000000000000000000000L
+		};
+		return values;
+	}
+};
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 2 узлам.
+template <>
+struct gauss_legendre_table<2> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			-0.5773502691896257645091488L,
+			 0.5773502691896257645091488L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 1.0000000000000000000000000L,
+			 1.0000000000000000000000000L
+		};
+		return values;
+	}
+};
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 3 узлам.
+template <>
+struct gauss_legendre_table<3> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			-0.7745966692414833770358531L,
+			 0.0000000000000000000000000L,
+			 0.7745966692414833770358531L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 0.5555555555555555555555556L,
+			 0.8888888888888888888888889L,
+			 0.5555555555555555555555556L
+		};
+		return values;
+	}
+};
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 4 узлам.
+template <>
+struct gauss_legendre_table<4> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			-0.8611363115940525752239465L,
+			-0.3399810435848562648026658L,
+			 0.3399810435848562648026658L,
+			 0.8611363115940525752239465L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 0.3478548451374538573730639L,
+			 0.6521451548625461426269361L,
+			 0.6521451548625461426269361L,
+			 0.3478548451374538573730639L
+		};
+		return values;
+	}
+};
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 5 узлам.
+template <>
+struct gauss_legendre_table<5> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			-0.9061798459386639927976269L,
+			-0.5384693101056830910363144L,
+			 0.0000000000000000000000000L,
+			 0.5384693101056830910363144L,
+			 0.9061798459386639927976269L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 0.2369268850561890875142640L,
+			 0.4786286704993664680412915L,
+			 0.5688888888888888888888889L,
+			 0.4786286704993664680412915L,
+			 0.2369268850561890875142640L
+		};
+		return values;
+	}
+};
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 6 узлам.
+template <>
+struct gauss_legendre_table<6> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			-0.9324695142031520278123016L,
+			-0.6612093864662645136613996L,
+			-0.2386191860831969086305017L,
+			 0.2386191860831969086305017L,
+			 0.6612093864662645136613996L,
+			 0.9324695142031520278123016L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 0.1713244923791703450402961L,
+			 0.3607615730481386075698335L,
+			 0.4679139345726910473898703L,
+			 0.4679139345726910473898703L,
+			 0.3607615730481386075698335L,
+			 0.1713244923791703450402961L
+		};
+		return values;
+	}
+};
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 7 узлам.
+template <>
+struct gauss_legendre_table<7> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			-0.9491079123427585245261897L,
+			-0.7415311855993944398638648L,
+			-0.4058451513773971669066064L,
+			 0.0000000000000000000000000L,
+			 0.4058451513773971669066064L,
+			 0.7415311855993944398638648L,
+			 0.9491079123427585245261897L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 0.1294849661688696932706114L,
+			 0.2797053914892766679014678L,
+			 0.3818300505051189449503698L,
+			 0.4179591836734693877551020L,
+			 0.3818300505051189449503698L,
+			 0.2797053914892766679014678L,
+			 0.1294849661688696932706114L
+		};
+		return values;
+	}
+};
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 8 узлам.
+template <>
+struct gauss_legendre_table<8> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			-0.9602898564975362316835609L,
+			-0.7966664774136267395915539L,
+			-0.5255324099163289858177390L,
+			-0.1834346424956498049394761L,
+			 0.1834346424956498049394761L,
+			 0.5255324099163289858177390L,
+			 0.7966664774136267395915539L,
+			 0.9602898564975362316835609L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 0.1012285362903762591525314L,
+			 0.2223810344533744705443560L,
+			 0.3137066458778872873379622L,
+			 0.3626837833783619829651504L,
+			 0.3626837833783619829651504L,
+			 0.3137066458778872873379622L,
+			 0.2223810344533744705443560L,
+			 0.1012285362903762591525314L
+		};
+		return values;
+	}
+};
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 9 узлам.
+template <>
+struct gauss_legendre_table<9> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			-0.9681602395076260898355762L,
+			-0.8360311073266357942994298L,
+			-0.6133714327005903973087020L,
+			-0.3242534234038089290385380L,
+			 0.0000000000000000000000000L,
+			 0.3242534234038089290385380L,
+			 0.6133714327005903973087020L,
+			 0.8360311073266357942994298L,
+			 0.9681602395076260898355762L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 0.0812743883615744119718922L,
+			 0.1806481606948574040584720L,
+			 0.2606106964029354623187429L,
+			 0.3123470770400028400686304L,
+			 0.3302393550012597631645251L,
+			 0.3123470770400028400686304L,
+			 0.2606106964029354623187429L,
+			 0.1806481606948574040584720L,
+			 0.0812743883615744119718922L
+		};
+		return values;
+	}
+};
+
+//! Узлы и веса квадратурной формулы Гаусса-Лежандра по 10 узлам.
+template <>
+struct gauss_legendre_table<10> {
+	static const long double * nodes() {
+		static const long double values[] = {
+			-0.9739065285171717200779640L,
+			-0.8650633666889845107320967L,
+			-0.6794095682990244062343274L,
+			-0.4333953941292471907992659L,
+			-0.1488743389816312108848260L,
+			 0.1488743389816312108848260L,
+			 0.4333953941292471907992659L,
+			 0.6794095682990244062343274L,
+			 0.8650633666889845107320967L,
+			 0.9739065285171717200779640L
+		};
+		return values;
+	}
+	static const long double * weights() {
+		static const long double values[] = {
+			 0.0666713443086881375935688L,
+			 0.1494513491505805931457763L,
+			 0.2190863625159820439955349L,
+			 0.2692667193099963550912269L,
+			 0.2955242247147528701738930L,
+			 0.2955242247147528701738930L,
+			 0.2692667193099963550912269L,
+			 0.2190863625159820439955349L,
+			 0.1494513491505805931457763L,
+			 0.0666713443086881375935688L
+		};
+		return values;
+	}
+};
+
+
+
+#endif // ifndef INTEGRATOR_GAUSS_LEGENDRE_TABLE_H
@@ -0,0 +1,358 @@
+/** \file integration_rules.hpp
+    \brief Содержит правила численного интегрирования со статической диспетчеризацией (без boost::function и виртуальных вызовов).
+*/
+
+#pragma once
+#ifndef INTEGRATOR_INTEGRATION_RULES_H
+#define INTEGRATOR_INTEGRATION_RULES_H
+
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "gauss_legendre_table.hpp"
+
+
+
+/** Рабочие массивы "пакетного" интегрирования: узлы и значения функции в них.
+ *
+ * Методы integrate_batch() и integrate_range_batch() правил и интеграторов
+ * могут принимать рабочие массивы от вызывающего: массивы только растут, так
+ * что при повторных вызовах с тем же числом узлов память не выделяется.
+ * Один экземпляр нельзя использовать одновременно из нескольких потоков.
+ *
+ * @tparam T Тип значения, возвращаемого функцией.
+ */
+template <class T>
+struct integration_workspace {
+
+	//! Узлы квадратурной формулы.
+	std::vector<long double> xs;
+	//! Значения функции в узлах.
+	std::vector<T> values;
+
+	//! Обеспечивает место под count узлов и значений (без уменьшения массивов).
+	void reserve_nodes (size_t count) {
+		if (xs.size() < count)
+			xs.resize (count);
+		if (values.size() < count)
+			values.resize (count);
+	}
+
+}; // struct integration_workspace
+
+
+
+/** Правило интегрирования по методу Симпсона.
+ *
+ * Правило - это класс с шаблонным методом integrate(), принимающим любой
+ * функтор; поэтому при вызове функтор может быть полностью встроен в цикл
+ * вычисления квадратурной суммы. Классы-интеграторы (см. класс integrator)
+ * используют правила для своей реализации.
+ */
+class simpson_rule {
+
+public:
+
+	//! Конструктор, принимает в качестве параметра шаг разбиения h (меньше h - выше точность).
+	explicit simpson_rule (long double h)
+		: h(h)
+	{ }
+
+	/** Выполняет численное интегрирование и возвращает результат.
+	 *
+	 * Число точек разбиения выбирается по шагу h, но не меньше 10 (и всегда чётное).
+	 *
+	 * @tparam T Тип значения, возвращаемого функцией.
+	 * @param f Функтор вида f(x), интеграл от которого требуется посчитать.
+	 */
+	template <class T, class F>
+	T integrate (F f, long double x0, long double x1) const {
+		int N = parts_count (x1 - x0);
+		long double h = (x1 - x0) / N;
+		T res = T();
+		for (int i=0; i<=N; ++i) {
+			long double x = x0 + h * i;
+			res += f(x) * ((i==0 || i==N) ? 1 : (i%2==0) ? 2 : 4);
+		}
+		return res * (x1 - x0) / N / 3.0;
+	}
+
+	/** Выполняет численное интегрирование на каждом из count подряд идущих отрезков длины step, начиная с x0.
+	 *
+	 * Результат для k-го отрезка [x0+k*step; x0+(k+1)*step] записывается в
+	 * result[k]. Значение функции на общем конце соседних отрезков вычисляется
+	 * один раз, так что на все отрезки уходит count*N+1 вычислений функции
+	 * вместо count*(N+1).
+	 */
+	template <class T, class F>
+	void integrate_range (F f, long double x0, long double step, size_t count, std::vector<T> & result) const {
+		result.resize (count);
+		if (! count)  return;
+
+		int N = parts_count (step);
+		long double h = step / N;
+		T left = f(x0);
+		for (size_t k=0; k<count; ++k) {
+			long double a = x0 + step * k;
+			T res = left;
+			for (int i=1; i<N; ++i)
+				res += f(a + h * i) * ((i%2==0) ? 2 : 4);
+			T right = f(x0 + step * (k + 1));
+			res += right;
+			result[k] = res * step / N / 3.0;
+			left = right;
+		}
+	}
+
+	/** Выполняет численное интегрирование "пакетной" функции и возвращает результат.
+	 *
+	 * То же, что integrate(), но функция вычисляется сразу во всех узлах
+	 * одним вызовом f(xs, count, values), записывающим в values[i] значение
+	 * функции в точке xs[i].
+	 */
+	template <class T, class F>
+	T integrate_batch (F f, long double x0, long double x1) const {
+		integration_workspace<T> workspace;
+		return integrate_batch<T> (f, x0, x1, workspace);
+	}
+
+	//! То же, что integrate_batch(), но узлы и значения хранятся в рабочих массивах workspace.
+	template <class T, class F>
+	T integrate_batch (F f, long double x0, long double x1, integration_workspace<T> & workspace) const {
+		int N = parts_count (x1 - x0);
+		long double h = (x1 - x0) / N;
+
+		workspace.reserve_nodes (N + 1);
+		long double * xs = &workspace.xs[0];
+		T * values = &workspace.values[0];
+		for (int i=0; i<=N; ++i)
+			xs[i] = x0 + h * i;
+		f (xs, size_t (N + 1), values);
+
+		T res = T();
+		for (int i=0; i<=N; ++i)
+			res += values[i] * ((i==0 || i==N) ? 1 : (i%2==0) ? 2 : 4);
+		return res * (x1 - x0) / N / 3.0;
+	}
+
+	/** Выполняет численное интегрирование "пакетной" функции на каждом из count подряд идущих отрезков длины step, начиная с x0.
+	 *
+	 * То же, что integrate_range(), но функция вычисляется сразу во всех
+	 * count*N+1 узлах одним вызовом (см. integrate_batch()).
+	 */
+	template <class T, class F>
+	void integrate_range_batch (F f, long double x0, long double step, size_t count, std::vector<T> & result) const {
+		integration_workspace<T> workspace;
+		integrate_range_batch<T> (f, x0, step, count, result, workspace);
+	}
+
+	//! То же, что integrate_range_batch(), но узлы и значения хранятся в рабочих массивах workspace.
+	template <class T, class F>
+	void integrate_range_batch (F f, long double x0, long double step, size_t count, std::vector<T> & result, integration_workspace<T> & workspace) const {
+		result.resize (count);
+		if (! count)  return;
+
+		int N = parts_count (step);
+		long double h = step / N;
+
+		// общий конец соседних отрезков входит в список узлов один раз
+		size_t nodes = count * N + 1;
+		workspace.reserve_nodes (nodes);
+		long double * xs = &workspace.xs[0];
+		T * values = &workspace.values[0];
+		for (size_t k=0; k<count; ++k) {
+			long double a = x0 + step * k;
+			for (int i=0; i<N; ++i)
+				xs[k * N + i] = a + h * i;
+		}
+		xs[count * N] = x0 + step * count;
+		f (xs, nodes, values);
+
+		for (size_t k=0; k<count; ++k) {
+			const T * v = &values[k * N];
+			T res = v[0];
+			for (int i=1; i<N; ++i)
+				res += v[i] * ((i%2==0) ? 2 : 4);
+			res += v[N];
+			result[k] = res * step / N / 3.0;
+		}
+	}
+
+	//! Возвращает число частей разбиения отрезка длины len: по шагу h, но не меньше 10 и всегда чётное.
+	int parts_count (long double len) const {
+		int N = int (len / h);
+		N = std::max (N, 10);
+		if (N % 2)  ++N;
+		return N;
+	}
+
+	//! параметр метода - h - шаг интегрирования
+	long double h;
+
+}; // class simpson_rule
+
+
+
+/** Правило интегрирования по квадратурной формуле Гаусса-Лежандра с N узлами (см. таблицу gauss_legendre_table).
+ *
+ * Если задан шаг h, то отрезок интегрирования предварительно делится на
+ * равные куски длины не более h, и формула применяется к каждому из них.
+ */
+template <int N>
+class gauss_legendre_rule {
+
+public:
+
+	//! Конструктор, принимает в качестве параметра наибольшую длину куска (если h не положительно, то формула применяется ко всему отрезку).
+	explicit gauss_legendre_rule (long double h = 0)
+		: h(h)
+	{ }
+
+	/** Выполняет численное интегрирование и возвращает результат.
+	 *
+	 * @tparam T Тип значения, возвращаемого функцией.
+	 * @param f Функтор вида f(x), интеграл от которого требуется посчитать.
+	 */
+	template <class T, class F>
+	T integrate (F f, long double x0, long double x1) const {
+		const long double * nodes = gauss_legendre_table<N>::nodes();
+		const long double * weights = gauss_legendre_table<N>::weights();
+
+		int pieces = pieces_count (x1 - x0);
+		long double half = (x1 - x0) / pieces / 2;
+		T res = T();
+		for (int i=0; i<pieces; ++i) {
+			long double middle = x0 + half * (2 * i + 1);
+			for (int j=0; j<N; ++j)
+				res += f (middle + half * nodes[j]) * weights[j];
+		}
+		return res * half;
+	}
+
+	/** Выполняет численное интегрирование на каждом из count подряд идущих отрезков длины step, начиная с x0.
+	 *
+	 * Результат для k-го отрезка записывается в result[k]. (Узлы формулы
+	 * Гаусса-Лежандра лежат строго внутри отрезка, так что переиспользовать
+	 * между отрезками нечего.)
+	 */
+	template <class T, class F>
+	void integrate_range (F f, long double x0, long double step, size_t count, std::vector<T> & result) const {
+		result.resize (count);
+		for (size_t k=0; k<count; ++k)
+			result[k] = integrate<T> (f, x0 + step * k, x0 + step * (k + 1));
+	}
+
+	/** Выполняет численное интегрирование "пакетной" функции и возвращает результат.
+	 *
+	 * То же, что integrate(), но функция вычисляется сразу во всех узлах
+	 * одним вызовом f(xs, count, values), записывающим в values[i] значение
+	 * функции в точке xs[i].
+	 */
+	template <class T, class F>
+	T integrate_batch (F f, long double x0, long double x1) const {
+		integration_workspace<T> workspace;
+		return integrate_batch<T> (f, x0, x1, workspace);
+	}
+
+	//! То же, что integrate_batch(), но узлы и значения хранятся в рабочих массивах workspace.
+	template <class T, class F>
+	T integrate_batch (F f, long double x0, long double x1, integration_workspace<T> & workspace) const {
+		T result;
+		integrate_range_batch_ (f, x0, x1 - x0, 1, &result, workspace);
+		return result;
+	}
+
+	/** Выполняет численное интегрирование "пакетной" функции на каждом из count подряд идущих отрезков длины step, начиная с x0.
+	 *
+	 * То же, что integrate_range(), но функция вычисляется сразу во всех
+	 * узлах всех отрезков одним вызовом (см. integrate_batch()).
+	 */
+	template <class T, class F>
+	void integrate_range_batch (F f, long double x0, long double step, size_t count, std::vector<T> & result) const {
+		integration_workspace<T> workspace;
+		integrate_range_batch<T> (f, x0, step, count, result, workspace);
+	}
+
+	//! То же, что integrate_range_batch(), но узлы и значения хранятся в рабочих массивах workspace.
+	template <class T, class F>
+	void integrate_range_batch (F f, long double x0, long double step, size_t count, std::vector<T> & result, integration_workspace<T> & workspace) const {
+		result.resize (count);
+		if (! count)  return;
+		integrate_range_batch_ (f, x0, step, count, &result[0], workspace);
+	}
+
+	//! Возвращает число кусков, на которые делится отрезок длины len.
+	int pieces_count (long double len) const {
+		if (h <= 0)
+			return 1;
+		return std::max (1, int (ceil (len / h)));
+	}
+
+	//! параметр метода - h - наибольшая длина куска
+	long double h;
+
+private:
+
+	//! Общая часть integrate_batch() и integrate_range_batch(): записывает интегралы по count отрезкам в result[0..count-1].
+	template <class T, class F>
+	void integrate_range_batch_ (F f, long double x0, long double step, size_t count, T * result, integration_workspace<T> & workspace) const {
+		const long double * nodes = gauss_legendre_table<N>::nodes();
+		const long double * weights = gauss_legendre_table<N>::weights();
+
+		int pieces = pieces_count (step);
+		long double half = step / pieces / 2;
+
+		size_t points = count * pieces * N;
+		workspace.reserve_nodes (points);
+		long double * xs = &workspace.xs[0];
+		T * values = &workspace.values[0];
+		for (size_t k=0; k<count; ++k) {
+			long double a = x0 + step * k;
+			for (int i=0; i<pieces; ++i) {
+				long double middle = a + half * (2 * i + 1);
+				for (int j=0; j<N; ++j)
+					xs[(k * pieces + i) * N + j] = middle + half * nodes[j];
+			}
+		}
+		f (xs, points, values);
+
+		for (size_t k=0; k<count; ++k) {
+			const T * v = &values[k * pieces * N];
+			T res = T();
+			for (int i=0; i<pieces * N; ++i)
+				res += v[i] * weights[i % N];
+			result[k] = res * half;
+		}
+	}
+
+}; // class gauss_legendre_rule
+
+
+
+/** Выполняет численное интегрирование функтора f по правилу rule и возвращает результат.
+ *
+ * В отличие от integrator::integrate(), здесь нет ни виртуальных вызовов, ни
+ * стирания типа функтора, так что компилятор может встроить f в цикл.
+ *
+ * @tparam T Тип значения, возвращаемого функцией.
+ */
+template <class T, class Rule, class F>
+inline T integrate (const Rule & rule, F f, long double x0, long double x1) {
+	return rule.template integrate<T> (f, x0, x1);
+}
+
+
+/** Выполняет численное интегрирование функтора f по правилу rule на каждом из count подряд идущих отрезков длины step, начиная с x0.
+ *
+ * Результат для k-го отрезка записывается в result[k].
+ */
+template <class T, class Rule, class F>
+inline void integrate_range (const Rule & rule, F f, long double x0, long double step, size_t count, std::vector<T> & result) {
+	rule.template integrate_range<T> (f, x0, step, count, result);
+}
+
+
+
+#endif // ifndef INTEGRATOR_INTEGRATION_RULES_H
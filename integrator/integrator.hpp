@@ -8,9 +8,13 @@
 
 
 
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 #include <string>
+#include <vector>
+#include "integration_rules.hpp"
 
 
 
@@ -18,6 +22,14 @@
  *
  * Предоставляет общую схему для алгоритмов вычисления определённых интегралов.
  *
+ * Интегратор ведёт счётчики: общее число посчитанных интегралов и общее
+ * число вычислений интегрируемой функции (см. get_total_integrals_count(),
+ * get_total_evaluations_count()). Счётчики пополняются классами-потомками
+ * (см. count_()) атомарно, поэтому интегратор без другого изменяемого
+ * состояния (simpson_integrator, gauss_legendre_integrator) можно
+ * одновременно использовать из нескольких потоков. Счётчики при этом общие:
+ * в них попадают вычисления всех потоков.
+ *
  * @tparam T Тип значения, возвращаемого функцией.
  */
 template <typename T>
@@ -25,6 +37,34 @@ class integrator {
 
 public:
 
+	/** Сокращение для типа "пакетной" функции.
+	 *
+	 * Пакетная функция вида f(xs, count, values) вычисляет значения сразу в
+	 * count точках: в values[i] записывается значение в точке xs[i].
+	 */
+	typedef boost::function < void (const long double *, size_t, T *) > t_batch_function;
+
+
+	integrator()
+		: total_integrals_count_ (0),
+		  total_evaluations_count_ (0)
+	{ }
+
+	//! Копия интегратора получает текущие значения счётчиков.
+	integrator (const integrator & other)
+		: total_integrals_count_ (other.get_total_integrals_count()),
+		  total_evaluations_count_ (other.get_total_evaluations_count())
+	{ }
+
+	integrator & operator= (const integrator & other) {
+		total_integrals_count_.store (other.get_total_integrals_count(), boost::memory_order_relaxed);
+		total_evaluations_count_.store (other.get_total_evaluations_count(), boost::memory_order_relaxed);
+		return *this;
+	}
+
+	virtual ~integrator() {
+	}
+
 	//! Возвращает название метода.
 	virtual std::string get_name() = 0;
 
@@ -36,28 +76,129 @@ public:
 	 */
 	virtual T integrate (boost::function < T(long double) > f, long double x0, long double x1) = 0;
 
+	/** Выполняет численное интегрирование на каждом из count подряд идущих отрезков длины step, начиная с x0.
+	 *
+	 * Результат для k-го отрезка [x0+k*step; x0+(k+1)*step] записывается в
+	 * result[k]. По умолчанию просто вызывает integrate() для каждого
+	 * отрезка, но классы-потомки могут переопределять этот метод, например,
+	 * чтобы не вычислять функцию дважды на общих концах соседних отрезков.
+	 *
+	 * @param f Функция вида f(x), интегралы от которой требуется посчитать.
+	 * @param x0 Левая граница первого отрезка.
+	 * @param step Длина каждого отрезка.
+	 * @param count Число отрезков.
+	 * @param result Массив, в который записываются результаты (его размер становится равным count).
+	 */
+	virtual void integrate_range (boost::function < T(long double) > f, long double x0, long double step, size_t count, std::vector<T> & result) {
+		result.resize (count);
+		for (size_t k=0; k<count; ++k)
+			result[k] = integrate (f, x0 + step * k, x0 + step * (k + 1));
+	}
+
+	/** Выполняет численное интегрирование пакетной функции (см. t_batch_function) и возвращает результат.
+	 *
+	 * Классы-потомки, которым заранее известны все узлы, переопределяют этот
+	 * метод, чтобы вычислять функцию во всех узлах одним вызовом. По
+	 * умолчанию пакетная функция вызывается для каждой точки по отдельности
+	 * через integrate().
+	 */
+	virtual T integrate_batch (t_batch_function f, long double x0, long double x1) {
+		return integrate (single_point_function_ (f), x0, x1);
+	}
+
+	/** Выполняет численное интегрирование пакетной функции (см. t_batch_function) на каждом из count подряд идущих отрезков длины step, начиная с x0.
+	 *
+	 * По умолчанию пакетная функция вызывается для каждой точки по отдельности
+	 * через integrate_range().
+	 */
+	virtual void integrate_range_batch (t_batch_function f, long double x0, long double step, size_t count, std::vector<T> & result) {
+		integrate_range (single_point_function_ (f), x0, step, count, result);
+	}
+
+	/** То же, что integrate_batch(), но узлы и значения функции хранятся в рабочих массивах workspace вызывающего.
+	 *
+	 * Позволяет не выделять память при каждом вызове (см.
+	 * integration_workspace). По умолчанию рабочие массивы не используются.
+	 */
+	virtual T integrate_batch (t_batch_function f, long double x0, long double x1, integration_workspace<T> & workspace) {
+		(void) workspace;
+		return integrate_batch (f, x0, x1);
+	}
+
+	//! То же, что integrate_range_batch(), но узлы и значения функции хранятся в рабочих массивах workspace вызывающего.
+	virtual void integrate_range_batch (t_batch_function f, long double x0, long double step, size_t count, std::vector<T> & result, integration_workspace<T> & workspace) {
+		(void) workspace;
+		integrate_range_batch (f, x0, step, count, result);
+	}
+
+
+	//! Возвращает общее число посчитанных интегралов (каждый отрезок integrate_range() считается отдельно).
+	boost::uint64_t get_total_integrals_count() const {
+		return total_integrals_count_.load (boost::memory_order_relaxed);
+	}
+
+	//! Возвращает общее число вычислений интегрируемой функции.
+	boost::uint64_t get_total_evaluations_count() const {
+		return total_evaluations_count_.load (boost::memory_order_relaxed);
+	}
+
+	//! Обнуляет счётчики (см. get_total_integrals_count(), get_total_evaluations_count()).
+	void reset_counters() {
+		total_integrals_count_.store (0, boost::memory_order_relaxed);
+		total_evaluations_count_.store (0, boost::memory_order_relaxed);
+	}
+
+
+protected:
+
+	//! Пополняет счётчики: посчитано integrals интегралов, на что ушло evaluations вычислений функции.
+	void count_ (boost::uint64_t integrals, boost::uint64_t evaluations) {
+		total_integrals_count_.fetch_add (integrals, boost::memory_order_relaxed);
+		total_evaluations_count_.fetch_add (evaluations, boost::memory_order_relaxed);
+	}
+
+
+private:
+
+	//! общее число посчитанных интегралов
+	boost::atomic<boost::uint64_t> total_integrals_count_;
+	//! общее число вычислений интегрируемой функции
+	boost::atomic<boost::uint64_t> total_evaluations_count_;
+
+	//! Обёртка, позволяющая вызывать пакетную функцию для одной точки.
+	struct single_point_function_ {
+		explicit single_point_function_ (const t_batch_function & f)
+			: f(f)
+		{ }
+		T operator() (long double x) const {
+			T value;
+			f (&x, 1, &value);
+			return value;
+		}
+		t_batch_function f;
+	};
+
 };
 
 
 
 #include "simpson_integrator.hpp"
+#include "gauss_legendre_integrator.hpp"
 
 
 //! Погрешность метода Симпсона по умолчанию.
-static long double default_integrator_step = 1E-5;
+static const long double default_integrator_step = 1E-5;
 
 
-//! Возвращает текущий выбранный алгоритм интегрирования (если никакой не выбран, то возвращает метод Симпсона).
+/** Возвращает новый экземпляр алгоритма интегрирования по умолчанию (метода Симпсона с шагом default_integrator_step).
+ *
+ * Глобально выбранного интегратора нет: каждый источник данных хранит свой
+ * интегратор (см. artifical_input::set_integrator()), а эта функция лишь
+ * создаёт интегратор для тех, кому его не указали явно.
+ */
 template <typename T>
-boost::shared_ptr< integrator<T> > default_integrator (boost::shared_ptr< integrator<T> > new_integrator = boost::shared_ptr< integrator<T> >()) {
-	static boost::shared_ptr< integrator<T> > selected_integrator;
-	if (new_integrator)
-		selected_integrator = new_integrator;
-
-	if (! selected_integrator)
-		selected_integrator = boost::shared_ptr< integrator<T> > (new simpson_integrator<T> (default_integrator_step));
-
-	return selected_integrator;
+boost::shared_ptr< integrator<T> > default_integrator() {
+	return boost::shared_ptr< integrator<T> > (new simpson_integrator<T> (default_integrator_step));
 }
 
 
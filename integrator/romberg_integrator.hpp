@@ -0,0 +1,129 @@
+/** \file romberg_integrator.hpp
+    \brief Содержит класс интегратора с помощью метода Ромберга (с контролем погрешности).
+*/
+
+#pragma once
+#ifndef INTEGRATOR_ROMBERG_INTEGRATOR_H
+#define INTEGRATOR_ROMBERG_INTEGRATOR_H
+
+
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "integrator.hpp"
+#include "../utility_functions.hpp"
+
+
+
+/** Класс для интегратора по методу Ромберга.
+ *
+ * На каждом уровне число отрезков формулы трапеций удваивается; сумма
+ * значений функции с предыдущего уровня сохраняется, так что на уровне k
+ * вычисляются только 2^(k-1) новых точек (середины прежних отрезков). По
+ * значениям формулы трапеций строится таблица экстраполяции Ричардсона,
+ * от которой хранится только последняя строка.
+ *
+ * Вычисление останавливается, когда соседние диагональные элементы
+ * таблицы отличаются не более чем на допуск (больший из абсолютного и
+ * относительного), либо когда достигнуто наибольшее число уровней.
+ *
+ * Число уровней и число вычислений функции, потраченных на последний вызов
+ * integrate(), можно узнать методами get_levels_count() и
+ * get_evaluations_count().
+ */
+template <class T>
+class romberg_integrator : public integrator<T> {
+
+public:
+
+	/** Конструктор, принимает в качестве параметров допуски на погрешность.
+	 *
+	 * \param absolute_tolerance абсолютный допуск на погрешность интеграла
+	 * \param relative_tolerance относительный допуск на погрешность интеграла
+	 * \param max_levels наибольшее число уровней (удвоений числа отрезков)
+	 */
+	romberg_integrator (long double absolute_tolerance, long double relative_tolerance = 0, int max_levels = 20)
+		: absolute_tolerance (absolute_tolerance),
+		  relative_tolerance (relative_tolerance),
+		  max_levels (max_levels),
+		  levels_count (0),
+		  evaluations_count (0)
+	{ }
+
+	//! Возвращает название метода
+	std::string get_name() {
+		std::ostringstream oss;
+		oss << "Метод Ромберга (абс. допуск = " << absolute_tolerance << ", отн. допуск = " << relative_tolerance << ")";
+		return oss.str();
+	}
+
+	//! Выполняет численное интегрирование и возвращает результат
+	T integrate (boost::function < T(long double) > f, long double x0, long double x1) {
+		long double len = x1 - x0;
+
+		// сумма значений функции во всех точках текущего уровня (концы - с весом 1/2)
+		T sum = (f(x0) + f(x1)) * 0.5;
+		evaluations_count = 2;
+
+		std::vector<T> row (1, sum * len);
+		std::vector<T> next;
+		int pieces = 1;
+		for (levels_count=1; levels_count<=max_levels; ++levels_count) {
+			// добавляем середины всех отрезков предыдущего уровня
+			long double h = len / pieces;
+			for (int i=0; i<pieces; ++i)
+				sum += f(x0 + h * (i + 0.5));
+			evaluations_count += pieces;
+			pieces *= 2;
+
+			// строим очередную строку таблицы Ричардсона
+			next.resize (row.size() + 1);
+			next[0] = sum * (len / pieces);
+			long double factor = 1;
+			for (size_t j=1; j<next.size(); ++j) {
+				factor *= 4;
+				next[j] = next[j-1] + (next[j-1] - row[j-1]) * (1 / (factor - 1));
+			}
+			row.swap (next);
+
+			long double error = distance (row.back(), next.back());
+			long double tolerance = std::max (absolute_tolerance, relative_tolerance * distance (row.back(), T()));
+			if (levels_count >= 2 && error <= tolerance)
+				break;
+		}
+		levels_count = std::min (levels_count, max_levels);
+
+		this->count_ (1, evaluations_count);
+		return row.back();
+	}
+
+	//! Возвращает число уровней (удвоений числа отрезков), потраченных на последний вызов integrate().
+	int get_levels_count() const {
+		return levels_count;
+	}
+
+	//! Возвращает число вычислений функции в последнем вызове integrate().
+	int get_evaluations_count() const {
+		return evaluations_count;
+	}
+
+protected:
+
+	//! параметр метода - абсолютный допуск на погрешность
+	long double absolute_tolerance;
+	//! параметр метода - относительный допуск на погрешность
+	long double relative_tolerance;
+	//! параметр метода - наибольшее число уровней
+	int max_levels;
+	//! число уровней в последнем вызове integrate()
+	int levels_count;
+	//! число вычислений функции в последнем вызове integrate()
+	int evaluations_count;
+
+}; // class romberg_integrator
+
+
+
+#endif // ifndef INTEGRATOR_ROMBERG_INTEGRATOR_H
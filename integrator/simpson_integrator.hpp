@@ -11,12 +11,15 @@
 #include <sstream>
 #include <string>
 #include "integrator.hpp"
+#include "integration_rules.hpp"
 
 
 
 /** Класс для интегратора по методу Симпсона
  *
  * Имеет точность порядка O(1/N^4), где N - число точек разбиения (параметр алгоритма).
+ *
+ * Само вычисление выполняется правилом simpson_rule.
  */
 template <class T>
 class simpson_integrator : public integrator<T> {
@@ -39,17 +42,44 @@ public:
 
 	//! Выполняет численное интегрирование и возвращает результат
 	T integrate (boost::function < T(long double) > f, long double x0, long double x1) {
-		int N = int ((x1 - x0) / h);
-		N = std::max (N, 10);
-		if (N % 2)  ++N;
-
-		long double h = (x1 - x0) / N;
-		T res = T();
-		for (int i=0; i<=N; ++i) {
-			long double x = x0 + h * i;
-			res += f(x) * ((i==0 || i==N) ? 1 : (i%2==0) ? 2 : 4);
-		}
-		return res * (x1 - x0) / N / 3.0;
+		simpson_rule rule (h);
+		this->count_ (1, rule.parts_count (x1 - x0) + 1);
+		return rule.integrate<T> (f, x0, x1);
+	}
+
+	//! Выполняет численное интегрирование на каждом из count подряд идущих отрезков длины step, переиспользуя значения функции на общих концах отрезков
+	void integrate_range (boost::function < T(long double) > f, long double x0, long double step, size_t count, std::vector<T> & result) {
+		simpson_rule rule (h);
+		if (count)
+			this->count_ (count, count * rule.parts_count (step) + 1);
+		rule.integrate_range<T> (f, x0, step, count, result);
+	}
+
+	//! Выполняет численное интегрирование пакетной функции, вычисляя её во всех узлах одним вызовом
+	T integrate_batch (typename integrator<T>::t_batch_function f, long double x0, long double x1) {
+		integration_workspace<T> workspace;
+		return integrate_batch (f, x0, x1, workspace);
+	}
+
+	//! Выполняет численное интегрирование пакетной функции на каждом из count подряд идущих отрезков длины step, вычисляя её во всех узлах одним вызовом
+	void integrate_range_batch (typename integrator<T>::t_batch_function f, long double x0, long double step, size_t count, std::vector<T> & result) {
+		integration_workspace<T> workspace;
+		integrate_range_batch (f, x0, step, count, result, workspace);
+	}
+
+	//! То же, что integrate_batch(), но узлы и значения функции хранятся в рабочих массивах workspace
+	T integrate_batch (typename integrator<T>::t_batch_function f, long double x0, long double x1, integration_workspace<T> & workspace) {
+		simpson_rule rule (h);
+		this->count_ (1, rule.parts_count (x1 - x0) + 1);
+		return rule.integrate_batch<T> (f, x0, x1, workspace);
+	}
+
+	//! То же, что integrate_range_batch(), но узлы и значения функции хранятся в рабочих массивах workspace
+	void integrate_range_batch (typename integrator<T>::t_batch_function f, long double x0, long double step, size_t count, std::vector<T> & result, integration_workspace<T> & workspace) {
+		simpson_rule rule (h);
+		if (count)
+			this->count_ (count, count * rule.parts_count (step) + 1);
+		rule.integrate_range_batch<T> (f, x0, step, count, result, workspace);
 	}
 
 protected:
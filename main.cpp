@@ -13,19 +13,11 @@
 
 
 
-void test_algorithm (boost::shared_ptr < algorithm<quaternion,vector3> > alg, long double h) {
+void test_algorithm (boost::shared_ptr < algorithm<quaternion,vector3> > alg, boost::shared_ptr < artifical_input<quaternion,vector3> > input, long double h) {
 	alg->set_step (h);
 	alg->set_last_time (3600);
 
 
-	boost::shared_ptr < artifical_input<quaternion,vector3> > input (
-		new artifical_input_plane_angles_harmonious (
-			plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
-			plane_angles (PI/2, PI, PI)
-		)
-	);
-	
-
 	math_modelling<quaternion,vector3> m;
 	m.set_data (input);
 	BOOST_AUTO( result, m.run_algorithm (alg) );
@@ -36,11 +28,11 @@ void test_algorithm (boost::shared_ptr < algorithm<quaternion,vector3> > alg, lo
 }
 
 template <class alg>
-void test_algorithm (long double h) {
+void test_algorithm (boost::shared_ptr < artifical_input<quaternion,vector3> > input, long double h) {
 	boost::shared_ptr < algorithm<quaternion,vector3> > alg (
 		new alg ()
 	);
-	test_algorithm (alg, h);
+	test_algorithm (alg, input, h);
 }
 
 
@@ -51,14 +43,24 @@ int main() {
 	std::cout.precision (20);
 
     for (long double h=0.8; ; h/=2) {
-		default_integrator (boost::shared_ptr< integrator<vector3> > (new simpson_integrator<vector3> (h / 10)));
 		std::cout << std::fixed << h << '\t';
 
-		test_algorithm < average_speed_algorithm<quaternion,vector3> > (h);
-		test_algorithm < average_speed_riccati_algorithm<quaternion,vector3> > (h);
-		test_algorithm < panov_algorithm > (h);
-		test_algorithm < panov_riccati_algorithm > (h);
-		test_algorithm < method_2step_4degree > (h);
+		// входные данные общие для всех алгоритмов; интегральные данные считаются
+		// один раз на самой мелкой сетке (у 4-шаговых алгоритмов шаг h/4)
+		boost::shared_ptr < artifical_input<quaternion,vector3> > input (
+			new artifical_input_plane_angles_harmonious (
+				plane_angles (20 * PI/180, 15 * PI/180, 20 * PI/180),
+				plane_angles (PI/2, PI, PI)
+			)
+		);
+		input->set_integrator (boost::shared_ptr< integrator<vector3> > (new simpson_integrator<vector3> (h / 10)));
+		input->precompute_integrated (h / 4, 3600);
+
+		test_algorithm < average_speed_algorithm<quaternion,vector3> > (input, h);
+		test_algorithm < average_speed_riccati_algorithm<quaternion,vector3> > (input, h);
+		test_algorithm < panov_algorithm > (input, h);
+		test_algorithm < panov_riccati_algorithm > (input, h);
+		test_algorithm < method_2step_4degree > (input, h);
 
 		std::cerr << std::endl;
 		std::cout << std::endl;
@@ -9,10 +9,14 @@
 
 
 #include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <cmath>
 #include <stdexcept>
+#include <vector>
 #include "../../algorithms/stuff/input_data.hpp"
 #include "../../algorithms/stuff/output_data.hpp"
 #include "../../constants.hpp"
+#include "../../integrator/integrator.hpp"
 
 
 
@@ -36,6 +40,30 @@
  * потребуются данные, вычисление которых потомок не определил, то обработчик
  * по умолчанию бросит исключение.
  *
+ * Интегральные данные можно заранее посчитать на целой сетке (см. метод
+ * precompute_integrated()): тогда запросы на отрезках с концами в узлах
+ * сетки выполняются за O(1), и таблица используется всеми алгоритмами,
+ * которые запускаются на данном источнике.
+ *
+ * Каждый источник хранит собственный интегратор (см. set_integrator()),
+ * которым потомки пользуются для численного интегрирования; по умолчанию это
+ * default_integrator(). Глобального состояния нет, поэтому разные источники
+ * могут независимо использоваться в разных потоках - в том числе с общим
+ * интегратором, если у того нет изменяемого состояния, кроме атомарных
+ * счётчиков (как у simpson_integrator и gauss_legendre_integrator;
+ * adaptive_simpson_integrator, например, запоминает число вычислений
+ * последнего вызова). Один и тот же источник одновременно из нескольких
+ * потоков использовать нельзя: потомки могут хранить рабочие массивы, а
+ * счётчики обращений (см. get_counters()) не синхронизированы.
+ *
+ * Источник считает обращения к своим входным данным (см. get_counters()).
+ * Вычисления подынтегральной функции берутся из разности счётчиков
+ * интегратора до и после запроса (если интегратор одновременно используется
+ * другими источниками, в неё попадут и их вычисления). Интегральные данные,
+ * полученные без вычислений подынтегральной функции - из таблицы
+ * precompute_integrated() или иначе (например, аналитически), - считаются
+ * отдельно (см. input_data_counters::unmetered_integrated_calls).
+ *
  * @tparam Q Выбранная алгебра (кватернионы/бикватернионы).
  * @tparam I Выбранный тип входных данных.
  */
@@ -53,7 +81,14 @@ public:
 	typedef boost::shared_ptr < t_input_data > t_input_data_ptr;
 	//! Сокращение для указателя на выходные данные.
 	typedef boost::shared_ptr < t_output_data > t_output_data_ptr;
+	//! Сокращение для указателя на интегратор.
+	typedef boost::shared_ptr < integrator<I> > t_integrator_ptr;
+
 
+	artifical_input()
+		: integrator_ (default_integrator<I>()),
+		  table_step_ (0)
+	{ }
 
 	virtual ~artifical_input() {
 	}
@@ -63,11 +98,94 @@ public:
 		return t_input_data_ptr (new input_data_layer_ (this));
 	}
 
+	/** Присваивает интегратор, которым будут вычисляться интегральные данные.
+	 *
+	 * Таблица, посчитанная методом precompute_integrated(), при этом
+	 * удаляется (она была посчитана прежним интегратором).
+	 */
+	void set_integrator (t_integrator_ptr new_integrator) {
+		if (! new_integrator)
+			throw std::invalid_argument ("Интегратор должен быть указан.");
+		integrator_ = new_integrator;
+		clear_integrated_table();
+	}
+
+	//! Возвращает интегратор, которым вычисляются интегральные данные.
+	t_integrator_ptr get_integrator() const {
+		return integrator_;
+	}
+
+
+	//! Возвращает счётчики обращений к входным данным с момента создания источника (или последнего вызова reset_counters()).
+	input_data_counters get_counters() const {
+		return counters_;
+	}
+
+	//! Обнуляет счётчики обращений к входным данным (см. get_counters()).
+	void reset_counters() {
+		counters_ = input_data_counters();
+	}
+
+
+	/** Заранее вычисляет интегральные данные на сетке 0, step, 2*step, ..., до момента last_time.
+	 *
+	 * В таблицу записываются накопленные интегралы от момента 0 до каждого
+	 * узла сетки. Суммирование ведётся с компенсацией погрешности по Кэхэну,
+	 * и вместе с каждой суммой хранится её поправка (сумма равна
+	 * table_[k] - table_compensation_[k] с точностью, много большей точности
+	 * типа I). После этого интегральные данные на любом отрезке с концами в
+	 * узлах сетки вычисляются как разность двух элементов таблицы с учётом
+	 * поправок, так что точность не падает с длиной прогона; остальные
+	 * запросы обрабатываются как обычно.
+	 *
+	 * Шаг сетки имеет смысл брать равным самому мелкому шагу входных данных
+	 * среди алгоритмов, которые будут запускаться (т.е. step / steps_count).
+	 */
+	void precompute_integrated (long double step, long double last_time) {
+		if (step <= 0)
+			throw std::logic_error ("Шаг сетки интегральных данных должен быть положительным.");
+
+		clear_integrated_table();
+		size_t count = size_t ((last_time + EPS) / step);
+
+		// отрезки интегрируются блоками, чтобы источник мог обработать их за один проход
+		const size_t block = 4096;
+		std::vector<I> increments;
+
+		table_.reserve (count + 1);
+		table_compensation_.reserve (count + 1);
+		table_.push_back (I());
+		table_compensation_.push_back (I());
+		I sum = I(),
+			compensation = I();
+		for (size_t k=0; k<count; k+=block) {
+			this->internal_get_integrated_range_ (step * k, step, std::min (block, count - k), increments);
+			for (size_t j=0; j<increments.size(); ++j) {
+				I y = increments[j] - compensation;
+				I t = sum + y;
+				compensation = (t - sum) - y;
+				sum = t;
+				table_.push_back (sum);
+				table_compensation_.push_back (compensation);
+			}
+		}
+
+		table_step_ = step;
+	}
+
+	//! Удаляет таблицу, посчитанную методом precompute_integrated().
+	void clear_integrated_table() {
+		table_.clear();
+		table_compensation_.clear();
+		table_step_ = 0;
+	}
+
 	//! Вычисляет и возвращает точное решение во все требуемые моменты времени.
 	t_output_data_ptr get_exact_solution (long double step, long double last_time) {
 		t_output_data_ptr result (new t_output_data);
-		for (long double t=0; t<=last_time+EPS; t+=step)
-			result->add (t, this->internal_get_exact_solution_ (t));
+		result->init_grid (step, last_time);
+		for (size_t i=0; i<result->get_count(); ++i)
+			(*result)[i] = this->internal_get_exact_solution_ (result->ts[i]);
 		return result;
 	}
 	
@@ -99,6 +217,17 @@ protected:
 		throw std::runtime_error ("Not implemented: integrated input data was not calculated.");
 	}
 
+	/** Возвращает интегральные входные данные на каждом из count подряд идущих отрезков длины step, начиная с момента t0.
+	 *
+	 * По умолчанию просто вызывает internal_get_integrated_() для каждого
+	 * отрезка; классы-потомки могут переопределять этот метод.
+	 */
+	virtual void internal_get_integrated_range_ (long double t0, long double step, size_t count, std::vector<I> & result) {
+		result.resize (count);
+		for (size_t k=0; k<count; ++k)
+			result[k] = this->internal_get_integrated_ (t0 + step * k, t0 + step * (k + 1));
+	}
+
 	//! Возвращает точное решение в указанный момент времени.
 	virtual Q internal_get_exact_solution_ (long double t) = 0;
 
@@ -106,6 +235,72 @@ protected:
 private:
 
 
+	//! Интегратор, которым вычисляются интегральные данные.
+	t_integrator_ptr integrator_;
+
+	//! Накопленные интегралы от момента 0 до каждого узла сетки (см. precompute_integrated()).
+	std::vector<I> table_;
+	//! Поправки Кэхэна к элементам table_: точная сумма равна table_[k] - table_compensation_[k].
+	std::vector<I> table_compensation_;
+	//! Шаг сетки таблицы table_ (или ноль, если таблица не посчитана).
+	long double table_step_;
+
+	//! Счётчики обращений к входным данным.
+	input_data_counters counters_;
+
+
+	/** Находит номер узла сетки таблицы, совпадающего с моментом t.
+	 *
+	 * @return false, если таблица не посчитана или t не является её узлом.
+	 */
+	bool find_table_node_ (long double t, size_t & idx) const {
+		if (table_step_ <= 0)
+			return false;
+		long double pos = t / table_step_,
+			rounded = floor (pos + 0.5);
+		if (fabs (pos - rounded) > EPS || rounded < 0 || rounded >= table_.size())
+			return false;
+		idx = size_t (rounded);
+		return true;
+	}
+
+	//! Возвращает разность накопленных интегралов в узлах idx2 и idx1 с учётом поправок.
+	I table_difference_ (size_t idx1, size_t idx2) const {
+		return (table_[idx2] - table_[idx1]) - (table_compensation_[idx2] - table_compensation_[idx1]);
+	}
+
+	//! Пытается вычислить интегральные данные на отрезке [t1;t2] по таблице (возвращает false, если это невозможно).
+	bool get_integrated_from_table_ (long double t1, long double t2, I & result) const {
+		size_t idx1, idx2;
+		if (! find_table_node_ (t1, idx1) || ! find_table_node_ (t2, idx2))
+			return false;
+		result = table_difference_ (idx1, idx2);
+		return true;
+	}
+
+	//! Пытается вычислить интегральные данные на сетке отрезков по таблице (возвращает false, если это невозможно).
+	bool get_integrated_range_from_table_ (long double t0, long double step, size_t count, std::vector<I> & result) const {
+		size_t first, stride;
+		if (! find_table_node_ (t0, first) || ! find_table_node_ (step, stride) || ! stride)
+			return false;
+		if (first + stride * count >= table_.size())
+			return false;
+
+		result.resize (count);
+		for (size_t k=0; k<count; ++k)
+			result[k] = table_difference_ (first + stride * k, first + stride * (k + 1));
+		return true;
+	}
+
+
+	//! Учитывает evaluations вычислений подынтегральной функции, потраченных на calls интегральных данных (если их нет - данные получены без интегратора).
+	void count_evaluations_ (boost::uint64_t calls, boost::uint64_t evaluations) {
+		counters_.integrand_evaluations += evaluations;
+		if (! evaluations)
+			counters_.unmetered_integrated_calls += calls;
+	}
+
+
 	//! Тонкая прослойка от нашего класса к классу input_data.
 	class input_data_layer_ : public input_data<Q,I> {
 	
@@ -120,11 +315,38 @@ private:
 		}
 
 		virtual I get_instanteous (long double t) {
+			++ that->counters_.instanteous_calls;
 			return that->internal_get_instanteous_ (t);
 		}
 
 		virtual I get_integrated (long double t1, long double t2) {
-			return that->internal_get_integrated_ (t1, t2);
+			++ that->counters_.integrated_calls;
+			I result;
+			if (that->get_integrated_from_table_ (t1, t2, result)) {
+				++ that->counters_.unmetered_integrated_calls;
+				return result;
+			}
+
+			boost::uint64_t evaluations = that->integrator_->get_total_evaluations_count();
+			result = that->internal_get_integrated_ (t1, t2);
+			that->count_evaluations_ (1, that->integrator_->get_total_evaluations_count() - evaluations);
+			return result;
+		}
+
+		virtual void get_integrated_range (long double t0, long double step, size_t count, std::vector<I> & result) {
+			that->counters_.integrated_calls += count;
+			if (that->get_integrated_range_from_table_ (t0, step, count, result)) {
+				that->counters_.unmetered_integrated_calls += count;
+				return;
+			}
+
+			boost::uint64_t evaluations = that->integrator_->get_total_evaluations_count();
+			that->internal_get_integrated_range_ (t0, step, count, result);
+			that->count_evaluations_ (count, that->integrator_->get_total_evaluations_count() - evaluations);
+		}
+
+		virtual input_data_counters get_counters() const {
+			return that->get_counters();
 		}
 
 	private:
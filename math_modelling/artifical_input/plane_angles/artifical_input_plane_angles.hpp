@@ -8,10 +8,12 @@
 
 
 
+#include <vector>
 #include <boost/bind.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/typeof/typeof.hpp>
 #include "../artifical_input.hpp"
+#include "../../../integrator/integrator.hpp"
 #include "../../../types/plane_angles.hpp"
 #include "../../../types/quaternion.hpp"
 #include "../../../types/vector3.hpp"
@@ -31,9 +33,22 @@
  * internal_get_instanteous_(), internal_get_integrated_(),
  * internal_get_exact_solution_(). (Для получения мгновенных данных по
  * самолётным углам и их производным вычисляется угловая скорость, для
- * получения интегральных данных производится численное интегрирование,
+ * получения интегральных данных производится численное интегрирование
+ * (интегратором, заданным методом set_integrator()),
  * а для получения точного решения самолётные углы конвертируются в
  * кватернион.)
+ *
+ * При интегрировании угловая скорость вычисляется "пакетно" - сразу во всех
+ * узлах квадратурной формулы (см. calc_omega_batch_()), так что
+ * классы-потомки могут вычислять углы целыми массивами
+ * (см. get_angs_batch_()).
+ *
+ * Узлы квадратурной формулы, значения угловой скорости и углы хранятся в
+ * рабочих массивах источника (workspace_, angles_buffer_), которые только
+ * растут: при повторных запросах отрезков той же длины память не выделяется.
+ * Поэтому запросы интегральных данных (кроме взятых из таблицы) изменяют
+ * источник, и один источник нельзя опрашивать из нескольких потоков
+ * одновременно.
  */
 class artifical_input_plane_angles : public artifical_input<quaternion,vector3> {
 
@@ -63,6 +78,55 @@ protected:
 	virtual plane_angles get_angs_diff_ (long double t) = 0;
 
 
+	//! Самолётные углы и их производные в нескольких точках - по отдельному массиву на каждую компоненту.
+	struct angles_batch_ {
+		long double * psi, * teta, * gamma;
+		long double * psi_diff, * teta_diff, * gamma_diff;
+	};
+
+
+	/** Записывает в out самолётные углы (get_angs_()) и их производные (get_angs_diff_()) в каждой из count точек ts.
+	 *
+	 * По умолчанию углы вычисляются по одной точке. Классы-потомки могут
+	 * переопределять этот метод, вычисляя каждую компоненту целым массивом.
+	 */
+	virtual void get_angs_batch_ (const long double * ts, size_t count, const angles_batch_ & out) {
+		for (size_t i=0; i<count; ++i) {
+			plane_angles angs = get_angs_ (ts[i]);
+			plane_angles angs_diff = get_angs_diff_ (ts[i]);
+			out.psi[i] = angs.psi;
+			out.teta[i] = angs.teta;
+			out.gamma[i] = angs.gamma;
+			out.psi_diff[i] = angs_diff.psi;
+			out.teta_diff[i] = angs_diff.teta;
+			out.gamma_diff[i] = angs_diff.gamma;
+		}
+	}
+
+
+	/** Возвращает интегральные входные данные за указанный промежуток времени.
+	 *
+	 * Интеграл угловой скорости находится численно с помощью интегратора
+	 * данного источника (см. set_integrator()), угловая скорость вычисляется
+	 * пакетно (см. calc_omega_batch_()). Классы-потомки, для которых интеграл можно найти
+	 * иначе, могут переопределять этот метод.
+	 */
+	virtual vector3 internal_get_integrated_ (long double t1, long double t2) {
+		BOOST_AUTO( func, boost::bind (&artifical_input_plane_angles::calc_omega_batch_, this, _1, _2, _3) );
+		return this->get_integrator()->integrate_batch (func, t1, t2, workspace_);
+	}
+
+	/** Возвращает интегральные входные данные на каждом из count подряд идущих отрезков длины step, начиная с момента t0.
+	 *
+	 * Все отрезки интегрируются одним вызовом integrator::integrate_range_batch()
+	 * интегратора данного источника.
+	 */
+	virtual void internal_get_integrated_range_ (long double t0, long double step, size_t count, std::vector<vector3> & result) {
+		BOOST_AUTO( func, boost::bind (&artifical_input_plane_angles::calc_omega_batch_, this, _1, _2, _3) );
+		this->get_integrator()->integrate_range_batch (func, t0, step, count, result, workspace_);
+	}
+
+
 private:
 
 
@@ -71,18 +135,15 @@ private:
 		return calc_omega_ (this->get_angs_ (t), this->get_angs_diff_ (t));
 	}
 
-	//! Возвращает интегральные входные данные за указанный промежуток времени.
-	virtual vector3 internal_get_integrated_ (long double t1, long double t2) {
-		BOOST_AUTO( func, boost::bind (&artifical_input_plane_angles::internal_get_instanteous_, this, _1) );
-		return default_integrator<vector3>()->integrate (func, t1, t2);
-	}
-
 	//! Возвращает точное решение в указанный момент времени.
 	virtual quaternion internal_get_exact_solution_ (long double t) {
 		return (quaternion) get_angs_ (t);
 	}
 
 
+protected:
+
+
 	//! Функция, вычисляющая мгновенную угловую скорость по заданным значениям самолётных углов и их производных.
 	vector3 calc_omega_ (const plane_angles & angs, const plane_angles & angs_diff) const {
 		vector3 result;
@@ -92,6 +153,42 @@ private:
 		return result;
 	}
 
+	/** Вычисляет мгновенную угловую скорость в каждой из count точек ts и записывает её в values.
+	 *
+	 * Углы запрашиваются одним вызовом get_angs_batch_(), синусы и косинусы
+	 * углов teta и gamma вычисляются по одному разу на точку. Формулы - те
+	 * же, что и в calc_omega_().
+	 */
+	void calc_omega_batch_ (const long double * ts, size_t count, vector3 * values) {
+		if (! count)  return;
+
+		if (angles_buffer_.size() < 6 * count)
+			angles_buffer_.resize (6 * count);
+		long double * buffer = &angles_buffer_[0];
+		angles_batch_ angs = {
+			buffer, buffer + count, buffer + 2 * count,
+			buffer + 3 * count, buffer + 4 * count, buffer + 5 * count
+		};
+		get_angs_batch_ (ts, count, angs);
+
+		for (size_t i=0; i<count; ++i) {
+			long double sin_teta = sin (angs.teta[i]), cos_teta = cos (angs.teta[i]);
+			long double sin_gamma = sin (angs.gamma[i]), cos_gamma = cos (angs.gamma[i]);
+			values[i].x =  angs.gamma_diff[i]                +  angs.psi_diff[i] * sin_teta;
+			values[i].y =  angs.teta_diff[i] * sin_gamma     +  angs.psi_diff[i] * cos_teta * cos_gamma;
+			values[i].z =  angs.teta_diff[i] * cos_gamma     -  angs.psi_diff[i] * cos_teta * sin_gamma;
+		}
+	}
+
+
+private:
+
+
+	//! рабочие массивы интегратора (узлы и значения угловой скорости)
+	integration_workspace<vector3> workspace_;
+	//! рабочий массив calc_omega_batch_(): углы и их производные (по count значений на компоненту)
+	std::vector<long double> angles_buffer_;
+
 
 }; // class artifical_input_plane_angles
 
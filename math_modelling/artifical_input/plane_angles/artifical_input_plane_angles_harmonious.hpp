@@ -8,7 +8,10 @@
 
 
 
+#include <algorithm>
+#include <cmath>
 #include "artifical_input_plane_angles.hpp"
+#include "../../../integrator/integration_rules.hpp"
 
 
 
@@ -28,6 +31,9 @@
  * получения интегральных данных производится численное интегрирование,
  * а для получения точного решения самолётные углы конвертируются в
  * кватернион.)
+ *
+ * Для гармонических колебаний интегральные данные можно получать и без
+ * численного интегрирования - см. метод set_analytic_increments().
  */
 class artifical_input_plane_angles_harmonious : public artifical_input_plane_angles {
 
@@ -46,7 +52,8 @@ public:
 	)
 		: amp_   (amplitude),
 		  freq_  (frequency),
-		  shift_ (shift)
+		  shift_ (shift),
+		  analytic_increments_ (false)
 	{ }
 
 
@@ -54,29 +61,259 @@ public:
 	}
 
 
+	/** Включает или выключает режим "аналитических приращений".
+	 *
+	 * В этом режиме интегральные данные вычисляются не интегратором
+	 * (см. set_integrator()), а разложением угловой скорости в ряд Тейлора
+	 * (см. series_order_) и его почленным интегрированием. Коэффициенты ряда
+	 * находятся точно - по формулам для производных гармонических функций и
+	 * рекуррентным формулам для синуса/косинуса и произведения рядов.
+	 *
+	 * По умолчанию режим выключен.
+	 */
+	void set_analytic_increments (bool enabled) {
+		analytic_increments_ = enabled;
+	}
+
+	//! Возвращает, включён ли режим "аналитических приращений" (см. set_analytic_increments()).
+	bool get_analytic_increments() const {
+		return analytic_increments_;
+	}
+
+
+	/** Функтор, вычисляющий мгновенную угловую скорость в заданный момент времени.
+	 *
+	 * В отличие от internal_get_instanteous_(), здесь нет виртуальных вызовов,
+	 * поэтому при интегрировании по правилу (см. integration_rules.hpp)
+	 * функтор целиком встраивается в цикл квадратурной суммы.
+	 */
+	class omega_function {
+
+	public:
+
+		explicit omega_function (const artifical_input_plane_angles_harmonious * that)
+			: that(that)
+		{ }
+
+		vector3 operator() (long double t) const {
+			return that->calc_omega_ (that->angs_at_ (t), that->angs_diff_at_ (t));
+		}
+
+	private:
+		const artifical_input_plane_angles_harmonious * that;
+
+	}; // class omega_function
+
+
+	/** Интегрирует угловую скорость по отрезку [t1;t2] по правилу rule (см. integration_rules.hpp).
+	 *
+	 * Это статически диспетчеризуемый аналог интегральных входных данных:
+	 * правило и подынтегральная функция известны на этапе компиляции.
+	 */
+	template <class Rule>
+	vector3 integrate_omega (const Rule & rule, long double t1, long double t2) const {
+		return integrate<vector3> (rule, omega_function (this), t1, t2);
+	}
+
+
+protected:
+
+
+	/** Возвращает интегральные входные данные за указанный промежуток времени.
+	 *
+	 * В режиме "аналитических приращений" (см. set_analytic_increments())
+	 * отрезок [t1;t2] разбивается на куски, на каждом из которых ряд Тейлора
+	 * угловой скорости в середине куска сходится достаточно быстро, и ряды
+	 * интегрируются почленно. Иначе используется численное интегрирование.
+	 */
+	virtual vector3 internal_get_integrated_ (long double t1, long double t2) {
+		if (! analytic_increments_)
+			return artifical_input_plane_angles::internal_get_integrated_ (t1, t2);
+
+		// куски выбираются так, чтобы (частота * (1 + амплитуда) * половина длины куска) не превосходило 0.5,
+		// а порядок ряда - так, чтобы отброшенный остаток ряда был меньше точности long double
+		long double rate = std::max (std::max (fabs (freq_.psi), fabs (freq_.teta)), fabs (freq_.gamma))
+			* (1 + std::max (std::max (fabs (amp_.psi), fabs (amp_.teta)), fabs (amp_.gamma)));
+		int pieces = std::max (1, int (ceil (fabs (t2 - t1) * rate)));
+
+		long double piece = (t2 - t1) / pieces,
+			x = fabs (piece) / 2 * rate,
+			remainder = x * x / 2;
+		int order = 0;
+		while (order < series_order_ && remainder > 1E-21L) {
+			order += 2;
+			remainder *= x * x / ((order + 1) * (order + 2));
+		}
+
+		vector3 result;
+		for (int i=0; i<pieces; ++i)
+			result += integrate_piece_ (t1 + piece * (i + 0.5), piece / 2, order);
+		return result;
+	}
+
+	/** Возвращает интегральные входные данные на каждом из count подряд идущих отрезков длины step, начиная с момента t0.
+	 *
+	 * В режиме "аналитических приращений" каждый отрезок обрабатывается
+	 * отдельно (см. internal_get_integrated_()), иначе - численным
+	 * интегрированием всех отрезков сразу.
+	 */
+	virtual void internal_get_integrated_range_ (long double t0, long double step, size_t count, std::vector<vector3> & result) {
+		if (analytic_increments_)
+			artifical_input<quaternion,vector3>::internal_get_integrated_range_ (t0, step, count, result);
+		else
+			artifical_input_plane_angles::internal_get_integrated_range_ (t0, step, count, result);
+	}
+
+
 private:
 
-	
+
+	//! Наибольший порядок ряда Тейлора в режиме "аналитических приращений".
+	static const int series_order_ = 16;
+
+	//! Отрезок ряда Тейлора (коэффициенты при степенях 0..series_order_).
+	struct series_ {
+		long double c[series_order_ + 1];
+	};
+
+
 	//! Амплитуда колебаний, по каждому из самолётных углов.
 	plane_angles amp_;
 	//! Частота колебаний, по каждому из самолётных углов.
 	plane_angles freq_;
 	//! Сдвиг колебаний, по каждому из самолётных углов.
 	plane_angles shift_;
+	//! Включён ли режим "аналитических приращений".
+	bool analytic_increments_;
+
 
 
 	//! Возвращает ориентацию в заданный момент времени.
 	virtual plane_angles get_angs_ (long double t) {
-		return amp_ * sin (freq_ * t + shift_);
+		return angs_at_ (t);
 	}
 
 
 	//! Возвращает производную от get_angs_() в заданный момент времени.
 	virtual plane_angles get_angs_diff_ (long double t) {
+		return angs_diff_at_ (t);
+	}
+
+
+	/** Записывает в out самолётные углы и их производные в каждой из count точек ts.
+	 *
+	 * Каждая компонента вычисляется отдельным циклом (см. harmonic_batch_()).
+	 */
+	virtual void get_angs_batch_ (const long double * ts, size_t count, const angles_batch_ & out) {
+		harmonic_batch_ (amp_.psi, freq_.psi, shift_.psi, ts, count, out.psi, out.psi_diff);
+		harmonic_batch_ (amp_.teta, freq_.teta, shift_.teta, ts, count, out.teta, out.teta_diff);
+		harmonic_batch_ (amp_.gamma, freq_.gamma, shift_.gamma, ts, count, out.gamma, out.gamma_diff);
+	}
+
+
+	/** Вычисляет гармоническую функцию amp*sin(freq*t+shift) и её производную в каждой из count точек ts.
+	 *
+	 * Синус и косинус одной и той же фазы стоят рядом, так что компилятор
+	 * может вычислять их одной инструкцией (sincos).
+	 */
+	static void harmonic_batch_ (long double amp, long double freq, long double shift, const long double * ts, size_t count, long double * angle, long double * angle_diff) {
+		long double amp_freq = amp * freq;
+		for (size_t i=0; i<count; ++i) {
+			long double phase = freq * ts[i] + shift;
+			angle[i] = amp * sin (phase);
+			angle_diff[i] = amp_freq * cos (phase);
+		}
+	}
+
+
+	//! Невиртуальная реализация get_angs_().
+	plane_angles angs_at_ (long double t) const {
+		return amp_ * sin (freq_ * t + shift_);
+	}
+
+	//! Невиртуальная реализация get_angs_diff_().
+	plane_angles angs_diff_at_ (long double t) const {
 		return amp_ * freq_ * cos (freq_ * t + shift_);
 	}
 
 
+	/** Интегрирует угловую скорость по отрезку [tm-half;tm+half] с помощью ряда Тейлора порядка order в точке tm.
+	 *
+	 * Формулы для угловой скорости - те же, что и в методе calc_omega_().
+	 */
+	vector3 integrate_piece_ (long double tm, long double half, int order) const {
+		series_ psi, teta, gamma, psi_diff, teta_diff, gamma_diff;
+		harmonic_series_ (amp_.psi, freq_.psi, shift_.psi, tm, psi, psi_diff, order);
+		harmonic_series_ (amp_.teta, freq_.teta, shift_.teta, tm, teta, teta_diff, order);
+		harmonic_series_ (amp_.gamma, freq_.gamma, shift_.gamma, tm, gamma, gamma_diff, order);
+
+		series_ sin_teta, cos_teta, sin_gamma, cos_gamma;
+		sin_cos_series_ (teta, sin_teta, cos_teta, order);
+		sin_cos_series_ (gamma, sin_gamma, cos_gamma, order);
+
+		series_ psi_sin_teta, psi_cos_teta, teta_sin_gamma, teta_cos_gamma, psi_cos_cos, psi_cos_sin;
+		mul_series_ (psi_diff, sin_teta, psi_sin_teta, order);
+		mul_series_ (psi_diff, cos_teta, psi_cos_teta, order);
+		mul_series_ (teta_diff, sin_gamma, teta_sin_gamma, order);
+		mul_series_ (teta_diff, cos_gamma, teta_cos_gamma, order);
+		mul_series_ (psi_cos_teta, cos_gamma, psi_cos_cos, order);
+		mul_series_ (psi_cos_teta, sin_gamma, psi_cos_sin, order);
+
+		vector3 result;
+		long double pw = 2 * half;
+		for (int k=0; k<=order; k+=2) {
+			long double w = pw / (k + 1);
+			result.x += w * (gamma_diff.c[k] + psi_sin_teta.c[k]);
+			result.y += w * (teta_sin_gamma.c[k] + psi_cos_cos.c[k]);
+			result.z += w * (teta_cos_gamma.c[k] - psi_cos_sin.c[k]);
+			pw *= half * half;
+		}
+		return result;
+	}
+
+	//! Вычисляет ряды Тейлора порядка order в точке tm для угла amp*sin(freq*t+shift) и его производной.
+	static void harmonic_series_ (long double amp, long double freq, long double shift, long double tm, series_ & angle, series_ & diff, int order) {
+		long double phase = freq * tm + shift,
+			s = sin (phase),
+			c = cos (phase);
+		// k-ая производная sin(x) равна sin, cos, -sin, -cos при k = 0, 1, 2, 3 (mod 4)
+		const long double trig[4] = { s, c, -s, -c };
+
+		long double coef = amp;
+		for (int k=0; k<=order; ++k) {
+			angle.c[k] = coef * trig[k % 4];
+			diff.c[k] = coef * freq * trig[(k + 1) % 4];
+			coef *= freq / (k + 1);
+		}
+	}
+
+	//! Вычисляет ряды Тейлора порядка order для синуса и косинуса от ряда u (по рекуррентным формулам из (sin u)' = u' cos u, (cos u)' = -u' sin u).
+	static void sin_cos_series_ (const series_ & u, series_ & s, series_ & c, int order) {
+		s.c[0] = sin (u.c[0]);
+		c.c[0] = cos (u.c[0]);
+		for (int k=1; k<=order; ++k) {
+			long double sum_s = 0,
+				sum_c = 0;
+			for (int j=1; j<=k; ++j) {
+				sum_s += j * u.c[j] * c.c[k-j];
+				sum_c += j * u.c[j] * s.c[k-j];
+			}
+			s.c[k] = sum_s / k;
+			c.c[k] = - sum_c / k;
+		}
+	}
+
+	//! Вычисляет произведение рядов a и b (до членов порядка order).
+	static void mul_series_ (const series_ & a, const series_ & b, series_ & result, int order) {
+		for (int k=0; k<=order; ++k) {
+			long double sum = 0;
+			for (int j=0; j<=k; ++j)
+				sum += a.c[j] * b.c[k-j];
+			result.c[k] = sum;
+		}
+	}
+
+
 }; // class artifical_input_plane_angles_harmonious
 
 
@@ -11,6 +11,7 @@
 #include <boost/range/algorithm.hpp>
 #include <boost/foreach.hpp>
 #include <boost/shared_ptr.hpp>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include "../algorithms/algorithm.hpp"
@@ -56,6 +57,8 @@ public:
 	typedef boost::shared_ptr < t_artifical_input > t_artifical_input_ptr;
 	//! Сокращение для указателя на выходные данные.
 	typedef boost::shared_ptr < t_output_data > t_output_data_ptr;
+	//! Сокращение для указателя на интегратор.
+	typedef typename t_artifical_input::t_integrator_ptr t_integrator_ptr;
 
 
 	/** Устанавливает новый источник входных данных и точных решений.
@@ -83,17 +86,37 @@ public:
 		std::vector<long double> differences;
 		//! Наибольшая погрешность.
 		long double max_difference;
+		//! Счётчики обращений алгоритма к входным данным (см. input_data_counters).
+		input_data_counters input_counters;
+
+		/** Возвращает наибольшую погрешность, умноженную на число вычислений подынтегральной функции.
+		 *
+		 * Чем меньше это произведение, тем выгоднее сочетание алгоритма и
+		 * интегратора: та же точность достигается меньшим числом вычислений.
+		 *
+		 * Если часть интегральных данных получена без вычислений
+		 * подынтегральной функции (из таблицы precompute_integrated() или
+		 * аналитически - см. input_data_counters::unmetered_integrated_calls),
+		 * то их цена неизвестна, и метрика недоступна: возвращается NaN (см.
+		 * has_error_evaluations_product()).
+		 */
+		long double get_error_evaluations_product() const {
+			if (! has_error_evaluations_product())
+				return std::numeric_limits<long double>::quiet_NaN();
+			return max_difference * input_counters.integrand_evaluations;
+		}
+
+		//! Возвращает, доступна ли метрика get_error_evaluations_product(), т.е. все ли интегральные данные посчитаны интегратором.
+		bool has_error_evaluations_product() const {
+			return input_counters.unmetered_integrated_calls == 0;
+		}
 
 
 	private:
 
 		//! Финализирует объект, довычисляя все характеристики, которые нельзя вычислить "на ходу".
 		void finalize_() {
-			size_t count = algorithm_output->get_count();
-			
-			differences.resize (count);
-			for (size_t i=0; i<count; ++i)
-				differences[i] = distance ((*algorithm_output)[i], (*exact_solution)[i]);
+			batch_distance (algorithm_output->qs, exact_solution->qs, differences);
 			max_difference = * boost::max_element (differences);
 		}
 
@@ -111,18 +134,31 @@ public:
 	 * за исключением входных данных input_data - они будут проставлены в
 	 * данном методе.
 	 *
+	 * Если указан интегратор integr, то он предварительно назначается
+	 * источнику данных (см. artifical_input::set_integrator()) и остаётся у
+	 * него и после тестирования.
+	 *
+	 * Перед запуском алгоритма счётчики обращений источника обнуляются, так
+	 * что в результат (см. result::input_counters) попадают обращения только
+	 * данного алгоритма.
+	 *
 	 * @throws std::logic_error Кидает исключение, если входные данные не были указаны.
 	 */
-	t_result_ptr run_algorithm (t_algorithm_ptr alg) {
+	t_result_ptr run_algorithm (t_algorithm_ptr alg, t_integrator_ptr integr = t_integrator_ptr()) {
 		if (! data_)
 			throw std::logic_error ("Перед запуском тестирования должны были быть указаны входные данные.");
 
+		if (integr)
+			data_->set_integrator (integr);
+
 		alg->set_input_data (data_->get_input_data());
 
 		t_result_ptr ret (new result());
 
 		ret->algorithm_title = alg->get_algorithm_title();
+		data_->reset_counters();
 		ret->algorithm_output = alg->execute();
+		ret->input_counters = data_->get_counters();
 		ret->exact_solution = data_->get_exact_solution (alg->get_step(), alg->get_last_time());
 
 		ret->finalize_();
@@ -0,0 +1,602 @@
+/** \file algorithm_generator.cpp
+    \brief Генератор алгоритмов для папки algorithms/auto_generated.
+
+	Алгоритм описывается текстовым файлом (см. 2_step.txt) - решение на
+	шаге задаётся как многочлен от входных данных на N последних отрезках,
+	которые рассматриваются как чисто векторные кватернионы:
+
+		name 2_step
+		description автоматически сгенерированный двухшаговый алгоритм
+		title Автоматически сгенерированный алгоритм (2-шаговый)
+		symbols omega1 omega2
+		term 1
+		term 1/2 omega1
+		term 17/192 omega1 omega1
+		...
+
+	Здесь omega1 - входные данные на текущем отрезке, omega2 - на
+	предыдущем и т.д.; каждая строка term - это слагаемое "коэффициент,
+	умноженный на кватернионное произведение перечисленных векторов".
+
+	Генератор не вычисляет кватернионные произведения в лоб, а раскрывает
+	их в скалярные и векторные произведения (для чисто векторных
+	кватернионов a*b = (-a.b, a x b)), приводит подобные, сокращает двойные
+	векторные произведения и выносит повторяющиеся скалярные и векторные
+	произведения в общие подвыражения. В заголовок записывается число
+	операций до и после упрощения.
+
+	Использование:
+
+		algorithm_generator 2_step.txt ../../algorithms/auto_generated/2_step.hpp
+*/
+#include <boost/lexical_cast.hpp>
+#include <boost/rational.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+
+//! Рациональный коэффициент.
+typedef boost::rational<long long> t_rational;
+
+/** Скалярный множитель: скалярное произведение "d a b" (a<=b) или смешанное произведение "t a b c" (a<b<c).
+ *
+ * Числа - номера векторов (0 - omega1, 1 - omega2, ...).
+ */
+typedef std::string t_factor;
+//! Одночлен - упорядоченный список скалярных множителей.
+typedef std::vector<t_factor> t_monomial;
+//! Многочлен от скалярных множителей.
+typedef std::map<t_monomial, t_rational> t_polynomial;
+//! Векторный множитель: вектор "s a" или векторное произведение "c a b" (a<b).
+typedef std::string t_atom;
+//! Векторное выражение: сумма векторных множителей с многочленами-коэффициентами.
+typedef std::map<t_atom, t_polynomial> t_vector_expression;
+
+
+//! Кватернионное выражение: скалярная и векторная части.
+struct quaternion_expression {
+	t_polynomial scalar;
+	t_vector_expression vector;
+};
+
+
+
+std::string key (char kind, int a) {
+	return std::string (1, kind) + " " + boost::lexical_cast<std::string> (a);
+}
+
+std::string key (char kind, int a, int b) {
+	return key (kind, a) + " " + boost::lexical_cast<std::string> (b);
+}
+
+std::string key (char kind, int a, int b, int c) {
+	return key (kind, a, b) + " " + boost::lexical_cast<std::string> (c);
+}
+
+//! Разбирает ключ множителя на тип и номера векторов.
+char parse_key (const std::string & k, std::vector<int> & indices) {
+	std::istringstream in (k);
+	char kind;
+	in >> kind;
+	indices.clear();
+	int idx;
+	while (in >> idx)
+		indices.push_back (idx);
+	return kind;
+}
+
+
+//! Добавляет к многочлену p многочлен q, умноженный на c.
+void add (t_polynomial & p, const t_polynomial & q, t_rational c = 1) {
+	for (t_polynomial::const_iterator it=q.begin(); it!=q.end(); ++it) {
+		t_rational & value = p[it->first];
+		value += it->second * c;
+		if (value == 0)
+			p.erase (it->first);
+	}
+}
+
+t_polynomial multiply (const t_polynomial & p, const t_polynomial & q) {
+	t_polynomial result;
+	for (t_polynomial::const_iterator a=p.begin(); a!=p.end(); ++a)
+		for (t_polynomial::const_iterator b=q.begin(); b!=q.end(); ++b) {
+			t_monomial m = a->first;
+			m.insert (m.end(), b->first.begin(), b->first.end());
+			std::sort (m.begin(), m.end());
+			t_polynomial term;
+			term[m] = a->second * b->second;
+			add (result, term);
+		}
+	return result;
+}
+
+t_polynomial constant (t_rational c) {
+	t_polynomial p;
+	if (c != 0)
+		p[t_monomial()] = c;
+	return p;
+}
+
+t_polynomial factor (const t_factor & f, t_rational c = 1) {
+	t_polynomial p;
+	p[t_monomial (1, f)] = c;
+	return p;
+}
+
+//! Добавляет к векторному выражению v выражение w, умноженное на многочлен p.
+void add (t_vector_expression & v, const t_vector_expression & w, const t_polynomial & p) {
+	for (t_vector_expression::const_iterator it=w.begin(); it!=w.end(); ++it) {
+		t_polynomial & value = v[it->first];
+		add (value, multiply (it->second, p));
+		if (value.empty())
+			v.erase (it->first);
+	}
+}
+
+t_vector_expression atom (const t_atom & a, t_rational c = 1) {
+	t_vector_expression v;
+	v[a] = constant (c);
+	return v;
+}
+
+
+//! Скалярное произведение a.b.
+t_polynomial dot (int a, int b) {
+	return factor (key ('d', std::min (a, b), std::max (a, b)));
+}
+
+//! Смешанное произведение (a x b).c (с приведением номеров к возрастающему порядку).
+t_polynomial triple (int a, int b, int c) {
+	if (a == b || b == c || a == c)
+		return t_polynomial();
+	int v[3] = { a, b, c };
+	int sign = 1;
+	for (int i=0; i<3; ++i)
+		for (int j=0; j+1<3-i; ++j)
+			if (v[j] > v[j+1]) {
+				std::swap (v[j], v[j+1]);
+				sign = -sign;
+			}
+	return factor (key ('t', v[0], v[1], v[2]), sign);
+}
+
+//! Векторное произведение a x b.
+t_vector_expression cross (int a, int b) {
+	if (a == b)
+		return t_vector_expression();
+	return a < b ? atom (key ('c', a, b)) : atom (key ('c', b, a), -1);
+}
+
+//! Скалярное произведение векторных множителей.
+t_polynomial dot (const t_atom & x, const t_atom & y) {
+	std::vector<int> a, b;
+	char kx = parse_key (x, a), ky = parse_key (y, b);
+	if (kx == 's' && ky == 's')
+		return dot (a[0], b[0]);
+	if (kx == 's')
+		return triple (b[0], b[1], a[0]);
+	if (ky == 's')
+		return triple (a[0], a[1], b[0]);
+	// (a0 x a1).(b0 x b1) = (a0.b0)(a1.b1) - (a0.b1)(a1.b0)
+	t_polynomial result = multiply (dot (a[0], b[0]), dot (a[1], b[1]));
+	add (result, multiply (dot (a[0], b[1]), dot (a[1], b[0])), -1);
+	return result;
+}
+
+//! Векторное произведение векторных множителей (двойные произведения раскрываются).
+t_vector_expression cross (const t_atom & x, const t_atom & y) {
+	std::vector<int> a, b;
+	char kx = parse_key (x, a), ky = parse_key (y, b);
+	t_vector_expression result;
+	if (kx == 's' && ky == 's')
+		return cross (a[0], b[0]);
+	if (kx == 's') {
+		// a x (b0 x b1) = b0 (a.b1) - b1 (a.b0)
+		add (result, atom (key ('s', b[0])), dot (a[0], b[1]));
+		add (result, atom (key ('s', b[1]), -1), dot (a[0], b[0]));
+		return result;
+	}
+	if (ky == 's') {
+		// (a0 x a1) x b = a1 (a0.b) - a0 (a1.b)
+		add (result, atom (key ('s', a[1])), dot (a[0], b[0]));
+		add (result, atom (key ('s', a[0]), -1), dot (a[1], b[0]));
+		return result;
+	}
+	// (a0 x a1) x (b0 x b1) = b0 ((a0 x a1).b1) - b1 ((a0 x a1).b0)
+	add (result, atom (key ('s', b[0])), triple (a[0], a[1], b[1]));
+	add (result, atom (key ('s', b[1]), -1), triple (a[0], a[1], b[0]));
+	return result;
+}
+
+
+//! Произведение кватернионных выражений: (s1, v1) (s2, v2) = (s1 s2 - v1.v2, s1 v2 + s2 v1 + v1 x v2).
+quaternion_expression multiply (const quaternion_expression & p, const quaternion_expression & q) {
+	quaternion_expression result;
+	result.scalar = multiply (p.scalar, q.scalar);
+	add (result.vector, q.vector, p.scalar);
+	add (result.vector, p.vector, q.scalar);
+
+	for (t_vector_expression::const_iterator a=p.vector.begin(); a!=p.vector.end(); ++a)
+		for (t_vector_expression::const_iterator b=q.vector.begin(); b!=q.vector.end(); ++b) {
+			t_polynomial coefficient = multiply (a->second, b->second);
+			add (result.scalar, multiply (dot (a->first, b->first), coefficient), -1);
+			add (result.vector, cross (a->first, b->first), coefficient);
+		}
+	return result;
+}
+
+
+
+/** Описание генерируемого алгоритма (см. формат в начале файла).
+ */
+struct algorithm_description {
+	std::string name;
+	//! Описание для документации ("автоматически сгенерированный ... алгоритм").
+	std::string description;
+	//! Название алгоритма (см. algorithm::get_algorithm_title()).
+	std::string title;
+	std::vector<std::string> symbols;
+	//! Слагаемые: коэффициент и номера векторов-сомножителей.
+	std::vector < std::pair < t_rational, std::vector<int> > > terms;
+};
+
+
+algorithm_description read_description (std::istream & in) {
+	algorithm_description result;
+	std::string line;
+	while (std::getline (in, line)) {
+		std::istringstream words (line);
+		std::string command;
+		if (! (words >> command) || command[0] == '#')
+			continue;
+
+		if (command == "name")
+			words >> result.name;
+		else if (command == "description")
+			std::getline (words >> std::ws, result.description);
+		else if (command == "title")
+			std::getline (words >> std::ws, result.title);
+		else if (command == "symbols") {
+			std::string symbol;
+			while (words >> symbol)
+				result.symbols.push_back (symbol);
+		}
+		else if (command == "term") {
+			std::string coefficient, symbol;
+			words >> coefficient;
+			t_rational c;
+			std::string::size_type slash = coefficient.find ('/');
+			if (slash == std::string::npos)
+				c = boost::lexical_cast<long long> (coefficient);
+			else
+				c = t_rational (boost::lexical_cast<long long> (coefficient.substr (0, slash)), boost::lexical_cast<long long> (coefficient.substr (slash + 1)));
+
+			std::vector<int> factors;
+			while (words >> symbol) {
+				std::vector<std::string>::iterator it = std::find (result.symbols.begin(), result.symbols.end(), symbol);
+				if (it == result.symbols.end())
+					throw std::runtime_error ("Unknown symbol: " + symbol);
+				factors.push_back (int (it - result.symbols.begin()));
+			}
+			result.terms.push_back (std::make_pair (c, factors));
+		}
+		else
+			throw std::runtime_error ("Unknown command: " + command);
+	}
+
+	if (result.name.empty() || result.symbols.empty() || result.description.empty() || result.title.empty())
+		throw std::runtime_error ("The description must contain 'name', 'description', 'title' and 'symbols'.");
+	return result;
+}
+
+
+//! Сумма всех слагаемых описания как кватернионное выражение.
+quaternion_expression expand (const algorithm_description & description) {
+	quaternion_expression result;
+	for (size_t t=0; t<description.terms.size(); ++t) {
+		quaternion_expression term;
+		term.scalar = constant (description.terms[t].first);
+		for (size_t f=0; f<description.terms[t].second.size(); ++f) {
+			quaternion_expression v;
+			v.vector = atom (key ('s', description.terms[t].second[f]));
+			term = multiply (term, v);
+		}
+		add (result.scalar, term.scalar);
+		add (result.vector, term.vector, constant (1));
+	}
+	return result;
+}
+
+
+/** Число операций с плавающей точкой при вычислении слагаемых в лоб (как в кватернионной алгебре).
+ *
+ * Произведение двух кватернионов - 16 умножений и 12 сложений, умножение
+ * кватерниона на число - 4 умножения, сложение кватернионов - 4 сложения.
+ */
+int naive_flops (const algorithm_description & description) {
+	int flops = 0;
+	for (size_t t=0; t<description.terms.size(); ++t) {
+		int degree = int (description.terms[t].second.size());
+		if (degree == 0) {
+			flops += 1;
+			continue;
+		}
+		flops += 28 * (degree - 1);
+		if (description.terms[t].first != 1)
+			flops += 4;
+		if (t > 0)
+			flops += 4;
+	}
+	return flops;
+}
+
+
+
+/** Генерирует код вычисления кватернионного выражения.
+ *
+ * Сначала вычисляются общие подвыражения (векторные произведения пар,
+ * скалярные и смешанные произведения), затем скалярная часть и векторная
+ * часть как сумма векторных множителей с коэффициентами.
+ */
+class code_writer {
+
+public:
+
+	code_writer (const algorithm_description & description)
+		: description_ (description),
+		  flops_ (0)
+	{ }
+
+	//! Возвращает строки кода (без отступа), присваивающие результат переменной lambda.
+	std::vector<std::string> write (const quaternion_expression & e) {
+		std::vector<std::string> lines;
+
+		// используемые векторные произведения: как векторные множители и внутри смешанных произведений
+		std::set<std::string> crosses, factors;
+		for (t_vector_expression::const_iterator it=e.vector.begin(); it!=e.vector.end(); ++it) {
+			if (it->first[0] == 'c')
+				crosses.insert (it->first);
+			collect_factors_ (it->second, factors);
+		}
+		collect_factors_ (e.scalar, factors);
+		for (std::set<std::string>::const_iterator it=factors.begin(); it!=factors.end(); ++it) {
+			std::vector<int> idx;
+			if (parse_key (*it, idx) == 't')
+				crosses.insert (key ('c', idx[0], idx[1]));
+		}
+
+		for (std::set<std::string>::const_iterator it=crosses.begin(); it!=crosses.end(); ++it) {
+			std::vector<int> idx;
+			parse_key (*it, idx);
+			lines.push_back ("I " + name_ (*it) + " = crossProduct (" + symbol_ (idx[0]) + ", " + symbol_ (idx[1]) + ");");
+			flops_ += 9;
+		}
+		for (std::set<std::string>::const_iterator it=factors.begin(); it!=factors.end(); ++it) {
+			std::vector<int> idx;
+			if (parse_key (*it, idx) == 'd')
+				lines.push_back ("t_scalar " + name_ (*it) + " = dotProduct (" + symbol_ (idx[0]) + ", " + symbol_ (idx[1]) + ");");
+			else
+				lines.push_back ("t_scalar " + name_ (*it) + " = dotProduct (" + name_ (key ('c', idx[0], idx[1])) + ", " + symbol_ (idx[2]) + ");");
+			flops_ += 5;
+		}
+
+		std::string vector;
+		for (t_vector_expression::const_iterator it=e.vector.begin(); it!=e.vector.end(); ++it) {
+			std::vector<int> idx;
+			std::string name = (parse_key (it->first, idx) == 's') ? symbol_ (idx[0]) : name_ (it->first);
+			if (! vector.empty()) {
+				vector += " + ";
+				flops_ += 3;
+			}
+			vector += name + " * (" + polynomial_ (it->second) + ")";
+			flops_ += 3;
+		}
+		if (vector.empty())
+			vector = "I()";
+
+		lines.push_back ("lambda = Q (");
+		lines.push_back ("\t" + polynomial_ (e.scalar) + ",");
+		lines.push_back ("\t" + vector);
+		lines.push_back (");");
+		return lines;
+	}
+
+	//! Возвращает число операций с плавающей точкой в сгенерированном коде.
+	int get_flops() const {
+		return flops_;
+	}
+
+private:
+
+	const algorithm_description & description_;
+	int flops_;
+
+	static void collect_factors_ (const t_polynomial & p, std::set<std::string> & factors) {
+		for (t_polynomial::const_iterator it=p.begin(); it!=p.end(); ++it)
+			factors.insert (it->first.begin(), it->first.end());
+	}
+
+	std::string symbol_ (int idx) const {
+		return description_.symbols[idx];
+	}
+
+	//! Имя переменной для общего подвыражения ("dot_omega1_omega2", "cross_omega1_omega2", "triple_...").
+	std::string name_ (const std::string & k) const {
+		std::vector<int> idx;
+		char kind = parse_key (k, idx);
+		std::string result = (kind == 'd') ? "dot" : (kind == 'c') ? "cross" : "triple";
+		for (size_t i=0; i<idx.size(); ++i)
+			result += "_" + symbol_ (idx[i]);
+		return result;
+	}
+
+	//! Код многочлена: сумма одночленов с коэффициентами вида "t_scalar (17) / 192".
+	std::string polynomial_ (const t_polynomial & p) {
+		if (p.empty())
+			return "0";
+
+		std::string result;
+		for (t_polynomial::const_iterator it=p.begin(); it!=p.end(); ++it) {
+			t_rational c = it->second;
+			if (! result.empty()) {
+				result += (c < 0) ? " - " : " + ";
+				flops_ += 1;
+			}
+			else if (c < 0)
+				result += "-";
+			c = abs (c);
+
+			std::string monomial;
+			for (size_t f=0; f<it->first.size(); ++f) {
+				if (f > 0) {
+					monomial += " * ";
+					flops_ += 1;
+				}
+				monomial += name_ (it->first[f]);
+			}
+
+			// деление в коэффициенте вычисляется при компиляции и в число операций не входит
+			std::string coefficient = "t_scalar (" + boost::lexical_cast<std::string> (c.numerator()) + ")";
+			if (c.denominator() != 1)
+				coefficient += " / " + boost::lexical_cast<std::string> (c.denominator());
+
+			if (monomial.empty())
+				result += coefficient;
+			else if (c == 1)
+				result += monomial;
+			else {
+				result += coefficient + " * " + monomial;
+				flops_ += 1;
+			}
+		}
+		return result;
+	}
+};
+
+
+
+//! Записывает заголовочный файл алгоритма.
+void write_header (std::ostream & out, const algorithm_description & d, const std::string & source) {
+	quaternion_expression e = expand (d);
+	code_writer writer (d);
+	std::vector<std::string> kernel = writer.write (e);
+
+	std::string guard = "ALGORITHMS_AUTO_GENERATED_" + d.name + "_H";
+	std::transform (guard.begin(), guard.end(), guard.begin(), ::toupper);
+	std::string class_name = "auto_generated_" + d.name + "_algorithm";
+	size_t n = d.symbols.size();
+
+	out << "/** \\file " << d.name << ".hpp\n"
+	    << "    \\brief Содержит алгоритм \"" << class_name << "\" - " << d.description << ".\n"
+	    << "\n"
+	    << "\tСгенерировано программой tools/algorithm_generator по описанию " << source << " -\n"
+	    << "\tне редактировать вручную. Решение на шаге: " << writer.get_flops() << " операций с плавающей\n"
+	    << "\tточкой (при вычислении кватернионных произведений в лоб - " << naive_flops (d) << ").\n"
+	    << "*/\n"
+	    << "\n"
+	    << "#pragma once\n"
+	    << "#ifndef " << guard << "\n"
+	    << "#define " << guard << "\n"
+	    << "\n\n\n"
+	    << "#include \"../algorithm.hpp\"\n"
+	    << "#include \"../stuff/rotation_functions.hpp\"\n"
+	    << "\n\n\n"
+	    << "/** Класс \"" << class_name << "\" - " << d.description << ".\n"
+	    << " *\n"
+	    << " * Алгебра Q должна строиться по скалярной и векторной частям: Q (s, v).\n"
+	    << " */\n"
+	    << "template <typename Q, typename I>\n"
+	    << "class " << class_name << " : public algorithm<Q,I> {\n"
+	    << "\n"
+	    << "public:\n"
+	    << "\n"
+	    << "\n"
+	    << "\t//! Запускает алгоритм, возвращая полученные результаты работы.\n"
+	    << "\tvirtual typename algorithm<Q, I>::t_output_data_ptr execute() {\n"
+	    << "\t\ttypename algorithm<Q, I>::t_output_data_ptr result = this->init_output_data_();\n"
+	    << "\t\ttypedef typename I::value_type t_scalar;\n"
+	    << "\n"
+	    << "\t\tfor (size_t i=1; i<result->get_count(); ++i) {\n"
+	    << "\t\t\tI " << d.symbols[0] << " = this->get_integrated_data (i);\n"
+	    << "\t\t\tQ lambda;\n"
+	    << "\n"
+	    << "\t\t\tif (i < " << n << ")\n"
+	    << "\t\t\t\tlambda = rotation_quaternion<Q> (" << d.symbols[0] << ");\n"
+	    << "\t\t\telse {\n";
+	for (size_t k=1; k<n; ++k)
+		out << "\t\t\t\tI " << d.symbols[k] << " = this->get_integrated_data (i - " << k << ");\n";
+	out << "\n";
+	for (size_t l=0; l<kernel.size(); ++l)
+		out << "\t\t\t\t" << kernel[l] << "\n";
+	out << "\t\t\t}\n"
+	    << "\n"
+	    << "\t\t\t(*result)[i] = (*result)[i-1] * lambda;\n"
+	    << "\t\t}\n"
+	    << "\n"
+	    << "\t\treturn result;\n"
+	    << "\t}\n"
+	    << "\n"
+	    << "\n"
+	    << "protected:\n"
+	    << "\n"
+	    << "\n"
+	    << "\t//! Алгоритму нужны входные данные на текущем и "
+	    << (n == 2 ? std::string ("предыдущем отрезках") : boost::lexical_cast<std::string> (n - 1) + " предыдущих отрезках") << ".\n"
+	    << "\tvirtual size_t get_history_capacity_() {\n"
+	    << "\t\treturn " << n << ";\n"
+	    << "\t}\n"
+	    << "\n"
+	    << "\n"
+	    << "public:\n"
+	    << "\n"
+	    << "\n"
+	    << "\t//! Возвращает название алгоритма в виде строки.\n"
+	    << "\tvirtual std::string get_algorithm_title() {\n"
+	    << "\t\treturn \"" << d.title << "\";\n"
+	    << "\t}\n"
+	    << "\n"
+	    << "\n"
+	    << "}; // class " << class_name << "\n"
+	    << "\n"
+	    << "\n"
+	    << "\n"
+	    << "#endif // ifndef " << guard << "\n";
+
+	std::cerr << d.name << ": " << writer.get_flops() << " flops (naive: " << naive_flops (d) << ")" << std::endl;
+}
+
+
+int main (int argc, char * argv[]) {
+	if (argc != 3) {
+		std::cerr << "Usage: algorithm_generator <description.txt> <output.hpp>" << std::endl;
+		return 1;
+	}
+
+	try {
+		std::ifstream in (argv[1]);
+		if (! in)
+			throw std::runtime_error (std::string ("Cannot open ") + argv[1]);
+		algorithm_description description = read_description (in);
+
+		std::string source = argv[1];
+		std::string::size_type slash = source.find_last_of ('/');
+		if (slash != std::string::npos)
+			source = source.substr (slash + 1);
+
+		std::ofstream out (argv[2]);
+		write_header (out, description, "tools/algorithm_generator/" + source);
+	}
+	catch (const std::exception & e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -18,91 +18,135 @@
 /** Класс "Бикватернион".
  *
  * Бикватернион - это дуальный кватернион вида a + s b, где a и b - кватернионы, s - мнимая единица (такая, что s^2 = 0).
+ *
+ * @tparam T Тип компонент (float, double, long double, __float128 - см. scalar.hpp).
  */
-class biquaternion {
+template <typename T>
+class basic_biquaternion {
 
 public:
 
+
+	//! Тип компонент бикватерниона.
+	typedef T value_type;
+
 	
 	/** Компоненты бикватерниона. */
 	//@{
-	quaternion a, b;
+	basic_quaternion<T> a, b;
 	//@}
 
 	
 	//! Конструктор нулевого бикватерниона.
-	biquaternion()
+	basic_biquaternion()
 		: a(), b()
 	{ }
 
-	biquaternion (const quaternion & a, const quaternion & b)
+	basic_biquaternion (const basic_quaternion<T> & a, const basic_quaternion<T> & b)
 		: a(a), b(b)
 	{ }
 
-	biquaternion (const dual_number & n0, const dual_number & n1, const dual_number & n2, const dual_number & n3)
+	basic_biquaternion (const basic_dual_number<T> & n0, const basic_dual_number<T> & n1, const basic_dual_number<T> & n2, const basic_dual_number<T> & n3)
 		: a (n0.real, n1.real, n2.real, n3.real),
 		  b (n0.imag, n1.imag, n2.imag, n3.imag)
 	{ }
 
-	biquaternion (const dual_number & scalar, const dual_vector & vector)
+	basic_biquaternion (const basic_dual_number<T> & scalar, const basic_dual_vector<T> & vector)
 		: a (scalar.real, vector.real),
 		  b (scalar.imag, vector.imag)
 	{ }
 
 
 	//! Компоненты бикватерниона - дуальные числа.
-	dual_number operator[] (int idx) const {
-		return dual_number (a[idx], b[idx]);
+	basic_dual_number<T> operator[] (int idx) const {
+		return basic_dual_number<T> (a[idx], b[idx]);
 	}
 
 	//! Скалярная часть бикватерниона - дуальное число, образованное скалярными частями кватернионов.
-	dual_number get_scalar() const {
-		return dual_number (a.get_scalar(), b.get_scalar());
+	basic_dual_number<T> get_scalar() const {
+		return basic_dual_number<T> (a.get_scalar(), b.get_scalar());
 	}
 
 	//! Векторная часть бикватерниона - дуальный вектор, образованный векторными частями кватернионов.
-	dual_vector get_vector() const {
-		return dual_vector (a.get_vector(), b.get_vector());
+	basic_dual_vector<T> get_vector() const {
+		return basic_dual_vector<T> (a.get_vector(), b.get_vector());
 	}
 
 
-	biquaternion operator+ (const biquaternion & q) const {
-		return biquaternion (a+q.a, b+q.b);
+	basic_biquaternion operator+ (const basic_biquaternion & q) const {
+		return basic_biquaternion (a+q.a, b+q.b);
 	}
 
-	biquaternion operator- (const biquaternion & q) const {
-		return biquaternion (a-q.a, b-q.b);
+	basic_biquaternion operator- (const basic_biquaternion & q) const {
+		return basic_biquaternion (a-q.a, b-q.b);
 	}
 
 	//! Умножение на константу.
-	biquaternion operator* (long double num) const {
-		return biquaternion (a*num, b*num);
+	basic_biquaternion operator* (T num) const {
+		return basic_biquaternion (a*num, b*num);
 	}
 
 	//! Деление на константу.
-	biquaternion operator/ (long double num) const {
-		return biquaternion (a/num, b/num);
+	basic_biquaternion operator/ (T num) const {
+		return basic_biquaternion (a/num, b/num);
 	}
 
 	//! Бикватернионное произведение.
-	biquaternion operator* (const biquaternion & q) const {
-		biquaternion result;
+	basic_biquaternion operator* (const basic_biquaternion & q) const {
+		basic_biquaternion result;
 		result.a = a * q.a + b * q.b;
 		result.b = a * q.b + b * q.a;
 		return result;
 	}
 
-	biquaternion operator- () const {
-		return biquaternion (-a, -b);
+	basic_biquaternion operator- () const {
+		return basic_biquaternion (-a, -b);
 	}
 
 
-}; // class biquaternion
+	basic_biquaternion & operator+= (const basic_biquaternion & q) {
+		a += q.a;
+		b += q.b;
+		return *this;
+	}
+
+	basic_biquaternion & operator-= (const basic_biquaternion & q) {
+		a -= q.a;
+		b -= q.b;
+		return *this;
+	}
+
+	basic_biquaternion & operator*= (T num) {
+		a *= num;
+		b *= num;
+		return *this;
+	}
+
+	basic_biquaternion & operator/= (T num) {
+		a /= num;
+		b /= num;
+		return *this;
+	}
+
+	//! Умножение справа на бикватернион q: *this = *this * q.
+	basic_biquaternion & operator*= (const basic_biquaternion & q) {
+		*this = *this * q;
+		return *this;
+	}
+
+
+}; // class basic_biquaternion
+
+
+
+//! Бикватернион с компонентами типа long double.
+typedef basic_biquaternion<long double> biquaternion;
 
 
 
 //! Возвращает расстояние между бикватернионами - максимум из расстояний между частями a и b.
-inline long double distance (const biquaternion & p, const biquaternion & q) {
+template <typename T>
+inline T distance (const basic_biquaternion<T> & p, const basic_biquaternion<T> & q) {
 	return std::max (distance (p.a, q.a), distance (p.b, q.b));
 }
 
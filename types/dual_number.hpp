@@ -7,127 +7,164 @@
 
 
 
+#include <cmath>
+#include <boost/config.hpp>
+#include "scalar.hpp"
+
+
+
 /** Класс "дуальное число".
  *
  * Это число вида a+sb, где s - мнимая единица (такая, что s^2 = 0).
+ *
+ * @tparam T Тип компонент (float, double, long double, __float128 - см. scalar.hpp).
  */
-class dual_number {
+template <typename T>
+class basic_dual_number {
 
 public:
 
+
+	//! Тип компонент числа.
+	typedef T value_type;
+
+
 	//! Действительная компонента числа.
-	long double real;
+	T real;
 	//! Мнимая компонента числа (домножающаяся на мнимую единицу s).
-	long double imag;
+	T imag;
 
 
-	dual_number()
+	BOOST_CONSTEXPR basic_dual_number() BOOST_NOEXCEPT
 		: real(0), imag(0)
 	{ }
 
-	explicit dual_number (long double real)
+	explicit BOOST_CONSTEXPR basic_dual_number (T real) BOOST_NOEXCEPT
 		: real(real), imag(0)
 	{ }
 
-	dual_number (long double real, long double imag)
+	BOOST_CONSTEXPR basic_dual_number (T real, T imag) BOOST_NOEXCEPT
 		: real(real), imag(imag)
 	{ }
 
 
-	dual_number operator+ (const dual_number & other) const {
-		return dual_number (real + other.real, imag + other.imag);
+	BOOST_CONSTEXPR basic_dual_number operator+ (const basic_dual_number & other) const BOOST_NOEXCEPT {
+		return basic_dual_number (real + other.real, imag + other.imag);
 	}
 
-	dual_number operator- (const dual_number & other) const {
-		return dual_number (real - other.real, imag - other.imag);
+	BOOST_CONSTEXPR basic_dual_number operator- (const basic_dual_number & other) const BOOST_NOEXCEPT {
+		return basic_dual_number (real - other.real, imag - other.imag);
 	}
 
-	dual_number operator* (const dual_number & other) const {
-		return dual_number (real * other.real, real * other.imag + other.real * imag);
+	BOOST_CONSTEXPR basic_dual_number operator* (const basic_dual_number & other) const BOOST_NOEXCEPT {
+		return basic_dual_number (real * other.real, real * other.imag + other.real * imag);
 	}
 
-	dual_number operator/ (const dual_number & other) const {
-		return dual_number (
+	BOOST_CONSTEXPR basic_dual_number operator/ (const basic_dual_number & other) const BOOST_NOEXCEPT {
+		return basic_dual_number (
 			real / other.real,
 			(imag * other.real - real * other.imag) / (other.real * other.real)
 		);
 	}
 
-	dual_number operator* (long double num) const {
-		return dual_number (real * num, imag * num);
+	BOOST_CONSTEXPR basic_dual_number operator* (T num) const BOOST_NOEXCEPT {
+		return basic_dual_number (real * num, imag * num);
 	}
 
-	dual_number operator/ (long double num) const {
-		return dual_number (real / num, imag / num);
+	BOOST_CONSTEXPR basic_dual_number operator/ (T num) const BOOST_NOEXCEPT {
+		return basic_dual_number (real / num, imag / num);
 	}
 
-	dual_number & operator+= (const dual_number & other) {
-		*this = *this + other;
+	BOOST_CXX14_CONSTEXPR basic_dual_number & operator+= (const basic_dual_number & other) BOOST_NOEXCEPT {
+		real += other.real;
+		imag += other.imag;
 		return *this;
 	}
 
-	dual_number & operator-= (const dual_number & other) {
-		*this = *this - other;
+	BOOST_CXX14_CONSTEXPR basic_dual_number & operator-= (const basic_dual_number & other) BOOST_NOEXCEPT {
+		real -= other.real;
+		imag -= other.imag;
 		return *this;
 	}
 
-	dual_number & operator*= (long double num) {
-		*this = *this * num;
+	BOOST_CXX14_CONSTEXPR basic_dual_number & operator*= (T num) BOOST_NOEXCEPT {
+		real *= num;
+		imag *= num;
 		return *this;
 	}
 
-	dual_number & operator/= (long double num) {
-		*this = *this / num;
+	BOOST_CXX14_CONSTEXPR basic_dual_number & operator/= (T num) BOOST_NOEXCEPT {
+		real /= num;
+		imag /= num;
 		return *this;
 	}
 
-}; // class dual_number
+}; // class basic_dual_number
+
+
 
+//! Дуальное число с компонентами типа long double.
+typedef basic_dual_number<long double> dual_number;
 
 
-inline dual_number operator* (long double num, const dual_number & dual_num) {
+
+template <typename T>
+inline BOOST_CONSTEXPR basic_dual_number<T> operator* (typename basic_dual_number<T>::value_type num, const basic_dual_number<T> & dual_num) BOOST_NOEXCEPT {
 	return dual_num * num;
 }
 
-inline dual_number sin (const dual_number & num) {
-	return dual_number (
+template <typename T>
+inline basic_dual_number<T> sin (const basic_dual_number<T> & num) {
+	return basic_dual_number<T> (
 		sin (num.real),
 		num.imag * cos (num.real)
 	);
 }
 
-inline dual_number cos (const dual_number & num) {
-	return dual_number (
+template <typename T>
+inline basic_dual_number<T> cos (const basic_dual_number<T> & num) {
+	return basic_dual_number<T> (
 		cos (num.real),
 		- num.imag * sin (num.real)
 	);
 }
 
-inline dual_number tan (const dual_number & num) {
-	return dual_number (
+template <typename T>
+inline basic_dual_number<T> tan (const basic_dual_number<T> & num) {
+	return basic_dual_number<T> (
 		tan (num.real),
 		num.imag / pow (cos (num.real), 2)
 	);
 }
 
-inline dual_number log (const dual_number & num) {
-	return dual_number (
+template <typename T>
+inline basic_dual_number<T> log (const basic_dual_number<T> & num) {
+	return basic_dual_number<T> (
 		log (num.real),
 		num.imag / num.real
 	);
 }
 
-inline dual_number exp (const dual_number & num) {
-	long double ex = exp (num.real);
-	return dual_number (
+template <typename T>
+inline basic_dual_number<T> exp (const basic_dual_number<T> & num) {
+	T ex = exp (num.real);
+	return basic_dual_number<T> (
 		ex,
 		ex * num.imag
 	);
 }
 
-inline dual_number sqrt (const dual_number & num) {
-	long double sq = sqrt (num.real);
-	return dual_number (
+/** Квадратный корень из дуального числа.
+ *
+ * Корень из нуля (0 + 0s) полагается равным нулю: так длина нулевого
+ * дуального вектора (см. basic_dual_vector::length()) - ноль, а не NaN.
+ */
+template <typename T>
+inline basic_dual_number<T> sqrt (const basic_dual_number<T> & num) {
+	T sq = sqrt (num.real);
+	if (sq == 0 && num.imag == 0)
+		return basic_dual_number<T>();
+	return basic_dual_number<T> (
 		sq,
 		num.imag / 2 / sq
 	);
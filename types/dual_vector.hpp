@@ -15,25 +15,33 @@
 /** Класс "дуальный вектор".
  *
  * Это вектор вида a+sb, где s - мнимая единица (такая, что s^2 = 0), a и b - вектора.
+ *
+ * @tparam T Тип компонент (float, double, long double, __float128 - см. scalar.hpp).
  */
-class dual_vector {
+template <typename T>
+class basic_dual_vector {
 
 public:
 
+
+	//! Тип компонент дуального вектора.
+	typedef T value_type;
+
+
 	//! Действительная компонента дуального вектора.
-	vector3 real;
+	basic_vector3<T> real;
 	//! Мнимая компонента дуального вектора (домножающаяся на мнимую единицу s).
-	vector3 imag;
+	basic_vector3<T> imag;
 
 
-	dual_vector()
+	basic_dual_vector()
 	{ }
 
-	dual_vector (const vector3 & real, const vector3 & imag)
+	basic_dual_vector (const basic_vector3<T> & real, const basic_vector3<T> & imag)
 		: real(real), imag(imag)
 	{ }
 
-	dual_vector (const dual_number & x, const dual_number & y, const dual_number & z)
+	basic_dual_vector (const basic_dual_number<T> & x, const basic_dual_number<T> & y, const basic_dual_number<T> & z)
 		: real (x.real, y.real, z.real),
 		  imag (x.imag, y.imag, z.imag)
 	{ }
@@ -43,80 +51,111 @@ public:
 	 *
 	 * @throws std::invalid_argument В случае, если передано некорректное значение idx.
 	 */
-	dual_number operator[] (int idx) const {
-		if (idx == 0)  return dual_number (real.x, imag.x);
-		if (idx == 1)  return dual_number (real.y, imag.y);
-		if (idx == 2)  return dual_number (real.z, imag.z);
+	basic_dual_number<T> operator[] (int idx) const {
+		if (idx == 0)  return basic_dual_number<T> (real.x, imag.x);
+		if (idx == 1)  return basic_dual_number<T> (real.y, imag.y);
+		if (idx == 2)  return basic_dual_number<T> (real.z, imag.z);
 		throw std::invalid_argument ("Invalid idx value.");
 	}
 
 
-	dual_number get_x() const {
-		return dual_number (real.x, imag.x);
+	basic_dual_number<T> get_x() const {
+		return basic_dual_number<T> (real.x, imag.x);
 	}
 
-	dual_number get_y() const {
-		return dual_number (real.y, imag.y);
+	basic_dual_number<T> get_y() const {
+		return basic_dual_number<T> (real.y, imag.y);
 	}
 
-	dual_number get_z() const {
-		return dual_number (real.z, imag.z);
+	basic_dual_number<T> get_z() const {
+		return basic_dual_number<T> (real.z, imag.z);
 	}
 
 
-	dual_vector operator+ (const dual_vector & other) const {
-		return dual_vector (real + other.real, imag + other.imag);
+	basic_dual_vector operator+ (const basic_dual_vector & other) const {
+		return basic_dual_vector (real + other.real, imag + other.imag);
 	}
 
-	dual_vector operator- (const dual_vector & other) const {
-		return dual_vector (real - other.real, imag - other.imag);
+	basic_dual_vector operator- (const basic_dual_vector & other) const {
+		return basic_dual_vector (real - other.real, imag - other.imag);
 	}
 
-	dual_vector operator* (long double num) const {
-		return dual_vector (real * num, imag * num);
+	basic_dual_vector operator* (T num) const {
+		return basic_dual_vector (real * num, imag * num);
 	}
 
-	dual_vector operator/ (long double num) const {
-		return dual_vector (real / num, imag / num);
+	basic_dual_vector operator/ (T num) const {
+		return basic_dual_vector (real / num, imag / num);
 	}
 
-	dual_vector operator* (const dual_number & num) const {
-		return dual_vector (
+	basic_dual_vector operator* (const basic_dual_number<T> & num) const {
+		return basic_dual_vector (
 			get_x() * num,
 			get_y() * num,
 			get_z() * num
 		);
 	}
 
-	dual_vector operator/ (const dual_number & num) const {
-		return dual_vector (
+	basic_dual_vector operator/ (const basic_dual_number<T> & num) const {
+		return basic_dual_vector (
 			get_x() / num,
 			get_y() / num,
 			get_z() / num
 		);
 	}
 
+	basic_dual_vector & operator+= (const basic_dual_vector & other) {
+		real += other.real;
+		imag += other.imag;
+		return *this;
+	}
+
+	basic_dual_vector & operator-= (const basic_dual_vector & other) {
+		real -= other.real;
+		imag -= other.imag;
+		return *this;
+	}
+
+	basic_dual_vector & operator*= (T num) {
+		real *= num;
+		imag *= num;
+		return *this;
+	}
+
+	basic_dual_vector & operator/= (T num) {
+		real /= num;
+		imag /= num;
+		return *this;
+	}
+
 
 	//! Модуль дуального вектора - дуальное число.
-	dual_number length() const {
-		dual_number sum;
+	basic_dual_number<T> length() const {
+		basic_dual_number<T> sum;
 		for (int i=0; i<3; ++i) {
-			dual_number cur = (*this)[i];
+			basic_dual_number<T> cur = (*this)[i];
 			sum += cur * cur;
 		}
 		return sqrt (sum);
 	}
 
 
-}; // class dual_vector
+}; // class basic_dual_vector
+
+
+
+//! Дуальный вектор с компонентами типа long double.
+typedef basic_dual_vector<long double> dual_vector;
 
 
 
-inline dual_vector operator* (long double num, const dual_vector & dual_vec) {
+template <typename T>
+inline basic_dual_vector<T> operator* (typename basic_dual_vector<T>::value_type num, const basic_dual_vector<T> & dual_vec) {
 	return dual_vec * num;
 }
 
-inline dual_vector operator* (const dual_number & num, const dual_vector & dual_vec) {
+template <typename T>
+inline basic_dual_vector<T> operator* (const basic_dual_number<T> & num, const basic_dual_vector<T> & dual_vec) {
 	return dual_vec * num;
 }
 
@@ -10,29 +10,42 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <boost/config.hpp>
 #include "vector3.hpp"
 
 
 
-//! Класс "матрица 3x3".
-class matrix33 {
+/** Класс "матрица 3x3".
+ *
+ * @tparam T Тип элементов (float, double, long double, __float128 - см. scalar.hpp).
+ */
+template <typename T>
+class basic_matrix33 {
 
 
 public:
 
+
+	//! Тип элементов матрицы.
+	typedef T value_type;
+
 	
 	//! Конструктор нулевой матрицы.
-	matrix33() {
-		memset (data_, 0, sizeof data_);
-	}
+	BOOST_CONSTEXPR basic_matrix33() BOOST_NOEXCEPT
+		: data_()
+	{ }
 
-	matrix33 (long double data[3][3]) {
+	BOOST_CXX14_CONSTEXPR basic_matrix33 (T data[3][3]) BOOST_NOEXCEPT
+		: data_()
+	{
 		for (int i=0; i<3; ++i)
 			for (int j=0; j<3; ++j)
 				data_[i][j] = data[i][j];
 	}
 
-	matrix33 (long double a11, long double a12, long double a13, long double a21, long double a22, long double a23, long double a31, long double a32, long double a33) {
+	BOOST_CXX14_CONSTEXPR basic_matrix33 (T a11, T a12, T a13, T a21, T a22, T a23, T a31, T a32, T a33) BOOST_NOEXCEPT
+		: data_()
+	{
 		data_[0][0] = a11;
 		data_[0][1] = a12;
 		data_[0][2] = a13;
@@ -47,48 +60,56 @@ public:
 
 	/** Индексированный доступ к элементам матрицы.
 	 *
-	 * @throws std::invalid_argument В случае, если передано некорректное значение row или column.
+	 * Индексы проверяются только в отладочной сборке (без NDEBUG).
+	 *
+	 * @throws std::invalid_argument В случае, если передано некорректное значение row или column (только в отладочной сборке).
 	 */
-	long double operator() (int row, int column) const {
+	BOOST_CXX14_CONSTEXPR T operator() (int row, int column) const {
+#ifndef NDEBUG
 		if (row < 0 || row >= 3)
 			throw std::invalid_argument ("Invalid row value.");
 		if (column < 0 || column >= 3)
 			throw std::invalid_argument ("Invalid column value.");
+#endif
 		return data_[row][column];
 	}
 
 	/** Индексированный доступ к элементам матрицы.
 	 *
-	 * @throws std::invalid_argument В случае, если передано некорректное значение row или column.
+	 * Индексы проверяются только в отладочной сборке (без NDEBUG).
+	 *
+	 * @throws std::invalid_argument В случае, если передано некорректное значение row или column (только в отладочной сборке).
 	 */
-	long double & operator() (int row, int column) {
+	BOOST_CXX14_CONSTEXPR T & operator() (int row, int column) {
+#ifndef NDEBUG
 		if (row < 0 || row >= 3)
 			throw std::invalid_argument ("Invalid row value.");
 		if (column < 0 || column >= 3)
 			throw std::invalid_argument ("Invalid column value.");
+#endif
 		return data_[row][column];
 	}
 
 	
-	matrix33 operator+ (const matrix33 & m) const {
-		matrix33 result = *this;
+	BOOST_CXX14_CONSTEXPR basic_matrix33 operator+ (const basic_matrix33 & m) const BOOST_NOEXCEPT {
+		basic_matrix33 result = *this;
 		return result += m;
 	}
 
-	matrix33 operator- (const matrix33 & m) const {
-		matrix33 result = *this;
+	BOOST_CXX14_CONSTEXPR basic_matrix33 operator- (const basic_matrix33 & m) const BOOST_NOEXCEPT {
+		basic_matrix33 result = *this;
 		return result -= m;
 	}
 
 	//! Умножение на константу.
-	matrix33 operator* (long double num) const {
-		matrix33 result = *this;
+	BOOST_CXX14_CONSTEXPR basic_matrix33 operator* (T num) const BOOST_NOEXCEPT {
+		basic_matrix33 result = *this;
 		return result *= num;
 	}
 
 	//! Матричное произведение.
-	matrix33 operator* (const matrix33 & m) const {
-		matrix33 result;
+	BOOST_CXX14_CONSTEXPR basic_matrix33 operator* (const basic_matrix33 & m) const BOOST_NOEXCEPT {
+		basic_matrix33 result;
 		for (int i=0; i<3; ++i)
 			for (int j=0; j<3; ++j)
 				result.data_[i][j] =
@@ -99,8 +120,8 @@ public:
 	}
 	
 	//! Умножение на вектор.
-	vector3 operator* (const vector3 & v) const {
-		return vector3 (
+	BOOST_CONSTEXPR basic_vector3<T> operator* (const basic_vector3<T> & v) const BOOST_NOEXCEPT {
+		return basic_vector3<T> (
 			data_[0][0] * v.x + data_[0][1] * v.y + data_[0][2] * v.z,
 			data_[1][0] * v.x + data_[1][1] * v.y + data_[1][2] * v.z,
 			data_[2][0] * v.x + data_[2][1] * v.y + data_[2][2] * v.z
@@ -108,25 +129,25 @@ public:
 	}
 
 	//! Деление на константу.
-	matrix33 operator/ (long double num) const {
-		matrix33 result = *this;
+	BOOST_CXX14_CONSTEXPR basic_matrix33 operator/ (T num) const BOOST_NOEXCEPT {
+		basic_matrix33 result = *this;
 		return result /= num;
 	}
 
 	//! Унарный минус.
-	matrix33 operator- () const {
-		return matrix33() - *this;
+	BOOST_CXX14_CONSTEXPR basic_matrix33 operator- () const BOOST_NOEXCEPT {
+		return basic_matrix33() - *this;
 	}
 
 
-	matrix33 & operator+= (const matrix33 & m) {
+	BOOST_CXX14_CONSTEXPR basic_matrix33 & operator+= (const basic_matrix33 & m) BOOST_NOEXCEPT {
 		for (int i=0; i<3; ++i)
 			for (int j=0; j<3; ++j)
 				data_[i][j] += m.data_[i][j];
 		return *this;
 	}
 
-	matrix33 & operator-= (const matrix33 & m) {
+	BOOST_CXX14_CONSTEXPR basic_matrix33 & operator-= (const basic_matrix33 & m) BOOST_NOEXCEPT {
 		for (int i=0; i<3; ++i)
 			for (int j=0; j<3; ++j)
 				data_[i][j] -= m.data_[i][j];
@@ -134,7 +155,7 @@ public:
 	}
 
 	//! Умножение на константу.
-	matrix33 & operator*= (long double num) {
+	BOOST_CXX14_CONSTEXPR basic_matrix33 & operator*= (T num) BOOST_NOEXCEPT {
 		for (int i=0; i<3; ++i)
 			for (int j=0; j<3; ++j)
 				data_[i][j] *= num;
@@ -142,13 +163,13 @@ public:
 	}
 
 	//! Матричное произведение.
-	matrix33 & operator*= (const matrix33 & m) {
+	BOOST_CXX14_CONSTEXPR basic_matrix33 & operator*= (const basic_matrix33 & m) BOOST_NOEXCEPT {
 		*this = *this * m;
 		return *this;
 	}
 	
 	//! Деление на константу.
-	matrix33 & operator/= (long double num) {
+	BOOST_CXX14_CONSTEXPR basic_matrix33 & operator/= (T num) BOOST_NOEXCEPT {
 		for (int i=0; i<3; ++i)
 			for (int j=0; j<3; ++j)
 				data_[i][j] /= num;
@@ -160,15 +181,21 @@ protected:
 
 
 	//! Компоненты матрицы.
-	long double data_[3][3];
+	T data_[3][3];
+
+
+}; // class basic_matrix33
+
 
 
-}; // class matrix33
+//! Матрица 3x3 с элементами типа long double.
+typedef basic_matrix33<long double> matrix33;
 
 
 
 //! Умножение на константу
-inline matrix33 operator* (long double num, const matrix33 & m) {
+template <typename T>
+inline BOOST_CXX14_CONSTEXPR basic_matrix33<T> operator* (typename basic_matrix33<T>::value_type num, const basic_matrix33<T> & m) BOOST_NOEXCEPT {
 	return m * num;
 }
 
@@ -9,6 +9,7 @@
 
 
 #include <cmath>
+#include <boost/config.hpp>
 #include "quaternion.hpp"
 #include "../utility_functions.hpp"
 
@@ -17,40 +18,47 @@
 /** Класс "plane_angles" - самолётные углы.
  *
  * Самолётные углы - это тройка углов (psi, teta, gamma - курс, крен, тангаж).
+ *
+ * @tparam T Тип углов (float, double, long double, __float128 - см. scalar.hpp).
  */
-class plane_angles {
+template <typename T>
+class basic_plane_angles {
 
 public:
 
+
+	//! Тип углов.
+	typedef T value_type;
+
 	
 	/** @name Тройка углов.
 	 */
 	//@{
-	long double psi, //!< угол psi - географический курс
+	T psi, //!< угол psi - географический курс
 		teta, //!< угол teta - угол тангажа
 		gamma; //!< угол gamma - угол крена
 	//@}
 
 	//! Конструктор нулевой тройки углов.
-	plane_angles()
+	BOOST_CONSTEXPR basic_plane_angles() BOOST_NOEXCEPT
 		: psi(0), teta(0), gamma(0)
 	{ }
 
 	//! Конструктор от тройки углов.
-	plane_angles (long double psi, long double teta, long double gamma)
+	BOOST_CONSTEXPR basic_plane_angles (T psi, T teta, T gamma) BOOST_NOEXCEPT
 		: psi(psi), teta(teta), gamma(gamma)
 	{ }
 
 	//! Конструктор из кватерниона.
-	explicit plane_angles (const quaternion & lambda) {
+	explicit basic_plane_angles (const basic_quaternion<T> & lambda) {
 		psi = atan ((lambda[0] * lambda[2] - lambda[1] * lambda[3]) / (sqr(lambda[0]) + sqr(lambda[1]) - 0.5));
 		teta = asin (2 * (lambda[1] * lambda[2] + lambda[0] * lambda[3]));
 		gamma = atan ((lambda[0] * lambda[1] - lambda[2] * lambda[3]) / (sqr(lambda[0]) + sqr(lambda[2]) - 0.5));
 	}
 
 	//! Преобразование к кватерниону.
-	operator quaternion() const {
-		return quaternion (
+	operator basic_quaternion<T>() const {
+		return basic_quaternion<T> (
 			cos(psi/2) * cos(teta/2) * cos(gamma/2) - sin(psi/2) * sin(teta/2) * sin(gamma/2),
 			sin(psi/2) * sin(teta/2) * cos(gamma/2) + cos(psi/2) * cos(teta/2) * sin(gamma/2),
 			sin(psi/2) * cos(teta/2) * cos(gamma/2) + cos(psi/2) * sin(teta/2) * sin(gamma/2),
@@ -59,24 +67,24 @@ public:
 	}
 
 
-	plane_angles operator+ (const plane_angles & p) const {
-		return plane_angles (
+	BOOST_CONSTEXPR basic_plane_angles operator+ (const basic_plane_angles & p) const BOOST_NOEXCEPT {
+		return basic_plane_angles (
 			psi   + p.psi,
 			teta  + p.teta,
 			gamma + p.gamma
 		);
 	}
 
-	plane_angles operator- (const plane_angles & p) const {
-		return plane_angles (
+	BOOST_CONSTEXPR basic_plane_angles operator- (const basic_plane_angles & p) const BOOST_NOEXCEPT {
+		return basic_plane_angles (
 			psi   - p.psi,
 			teta  - p.teta,
 			gamma - p.gamma
 		);
 	}
 
-	plane_angles operator* (long double p) const {
-		return plane_angles (
+	BOOST_CONSTEXPR basic_plane_angles operator* (T p) const BOOST_NOEXCEPT {
+		return basic_plane_angles (
 			psi   * p,
 			teta  * p,
 			gamma * p
@@ -84,8 +92,8 @@ public:
 	}
 
 	//! Скалярное произведение.
-	plane_angles operator* (const plane_angles & p) const {
-		return plane_angles (
+	BOOST_CONSTEXPR basic_plane_angles operator* (const basic_plane_angles & p) const BOOST_NOEXCEPT {
+		return basic_plane_angles (
 			psi   * p.psi,
 			teta  * p.teta,
 			gamma * p.gamma
@@ -93,13 +101,19 @@ public:
 	}
 
 
-}; // class plane_angles
+}; // class basic_plane_angles
+
+
+
+//! Самолётные углы типа long double.
+typedef basic_plane_angles<long double> plane_angles;
 
 
 
 //! Взятие синуса покомпонентно.
-inline plane_angles sin (const plane_angles & p) {
-	return plane_angles (
+template <typename T>
+inline basic_plane_angles<T> sin (const basic_plane_angles<T> & p) {
+	return basic_plane_angles<T> (
 		sin (p.psi),
 		sin (p.teta),
 		sin (p.gamma)
@@ -107,8 +121,9 @@ inline plane_angles sin (const plane_angles & p) {
 }
 
 //! Взятие косинуса покомпонентно.
-inline plane_angles cos (const plane_angles & p) {
-	return plane_angles (
+template <typename T>
+inline basic_plane_angles<T> cos (const basic_plane_angles<T> & p) {
+	return basic_plane_angles<T> (
 		cos (p.psi),
 		cos (p.teta),
 		cos (p.gamma)
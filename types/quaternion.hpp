@@ -11,211 +11,347 @@
 #include <cmath>
 #include <iosfwd>
 #include <stdexcept>
+#include <boost/config.hpp>
 #include "vector3.hpp"
 #include "../constants.hpp"
 
 
 
+template <typename T>
+class quaternion_kernels;
+
+
+
 /** Класс "Кватернион".
  *
  * Кватернион - это гиперкомплексное число с четырьмя компонентами (w, x, y, z).
+ *
+ * @tparam T Тип компонент (float, double, long double, __float128 - см. scalar.hpp).
  */
-class quaternion {
+template <typename T>
+class basic_quaternion {
 
 public:
 
+
+	//! Тип компонент кватерниона.
+	typedef T value_type;
+
 	
 	/** Компоненты кватерниона. */
 	//@{
-	long double w, x, y, z;
+	T w, x, y, z;
 	//@}
 
 	
 	//! Конструктор нулевого кватерниона.
-	quaternion()
+	BOOST_CONSTEXPR basic_quaternion() BOOST_NOEXCEPT
 		: w(0), x(0), y(0), z(0)
 	{ }
 
-	quaternion (long double w, long double x, long double y, long double z)
+	BOOST_CONSTEXPR basic_quaternion (T w, T x, T y, T z) BOOST_NOEXCEPT
 		: w(w), x(x), y(y), z(z)
 	{ }
 
 	//! Конструктор кватерниона от скалярной и векторной частей.
-	quaternion (long double w, const vector3 & v)
+	BOOST_CONSTEXPR basic_quaternion (T w, const basic_vector3<T> & v) BOOST_NOEXCEPT
 		: w(w), x(v.x), y(v.y), z(v.z)
 	{ }
 
 	//! Конструктор кватерниона с нулевой векторной частью.
-	explicit quaternion (long double num)
+	explicit BOOST_CONSTEXPR basic_quaternion (T num) BOOST_NOEXCEPT
 		: w(num), x(0), y(0), z(0)
 	{ }
 
 	//! Конструктор кватерниона с нулевой скалярной частью.
-	quaternion (const vector3 & v)
+	BOOST_CONSTEXPR basic_quaternion (const basic_vector3<T> & v) BOOST_NOEXCEPT
 		: w(0), x(v.x), y(v.y), z(v.z)
 	{ }
 
+	//! Конструктор из кватерниона с компонентами другого типа.
+	template <typename U>
+	explicit BOOST_CONSTEXPR basic_quaternion (const basic_quaternion<U> & q) BOOST_NOEXCEPT
+		: w(T(q.w)), x(T(q.x)), y(T(q.y)), z(T(q.z))
+	{ }
+
 
 	/** Индексированный доступ к компонентам кватерниона.
 	 *
-	 * @throws std::invalid_argument В случае, если передано некорректное значение idx.
+	 * Индекс проверяется только в отладочной сборке (без NDEBUG).
+	 *
+	 * @throws std::invalid_argument В случае, если передано некорректное значение idx (только в отладочной сборке).
 	 */
-	long double operator[] (int idx) const {
+	BOOST_CXX14_CONSTEXPR T operator[] (int idx) const {
 		if (idx == 0)  return w;
 		if (idx == 1)  return x;
 		if (idx == 2)  return y;
-		if (idx == 3)  return z;
-		throw std::invalid_argument ("Invalid idx value.");
+#ifndef NDEBUG
+		if (idx != 3)
+			throw std::invalid_argument ("Invalid idx value.");
+#endif
+		return z;
 	}
 
 	/** Индексированный доступ к компонентам кватерниона.
 	 *
-	 * @throws std::invalid_argument В случае, если передано некорректное значение idx.
+	 * Индекс проверяется только в отладочной сборке (без NDEBUG).
+	 *
+	 * @throws std::invalid_argument В случае, если передано некорректное значение idx (только в отладочной сборке).
 	 */
-	long double & operator[] (int idx) {
+	BOOST_CXX14_CONSTEXPR T & operator[] (int idx) {
 		if (idx == 0)  return w;
 		if (idx == 1)  return x;
 		if (idx == 2)  return y;
-		if (idx == 3)  return z;
-		throw std::invalid_argument ("Invalid idx value.");
+#ifndef NDEBUG
+		if (idx != 3)
+			throw std::invalid_argument ("Invalid idx value.");
+#endif
+		return z;
 	}
 
 
 	//! Скалярная часть кватерниона - член w.
-	long double get_scalar() const {
+	BOOST_CONSTEXPR T get_scalar() const BOOST_NOEXCEPT {
 		return w;
 	}
 
 	//! Векторная часть кватерниона - вектор, образованный членами (x,y,z).
-	vector3 get_vector() const {
-		return vector3 (x, y, z);
+	BOOST_CONSTEXPR basic_vector3<T> get_vector() const BOOST_NOEXCEPT {
+		return basic_vector3<T> (x, y, z);
 	}
 
 	
-	quaternion operator+ (long double num) const {
-		return quaternion (w+num, x, y, z);
+	BOOST_CONSTEXPR basic_quaternion operator+ (T num) const BOOST_NOEXCEPT {
+		return basic_quaternion (w+num, x, y, z);
 	}
 
-	quaternion operator+ (const quaternion & q) const {
-		return quaternion (w+q.w, x+q.x, y+q.y, z+q.z);
+	BOOST_CONSTEXPR basic_quaternion operator+ (const basic_quaternion & q) const BOOST_NOEXCEPT {
+		return basic_quaternion (w+q.w, x+q.x, y+q.y, z+q.z);
 	}
 
-	quaternion operator- (long double num) const {
-		return quaternion (w-num, x, y, z);
+	BOOST_CONSTEXPR basic_quaternion operator- (T num) const BOOST_NOEXCEPT {
+		return basic_quaternion (w-num, x, y, z);
 	}
 
-	quaternion operator- (const quaternion & q) const {
-		return quaternion (w-q.w, x-q.x, y-q.y, z-q.z);
+	BOOST_CONSTEXPR basic_quaternion operator- (const basic_quaternion & q) const BOOST_NOEXCEPT {
+		return basic_quaternion (w-q.w, x-q.x, y-q.y, z-q.z);
 	}
 
 	//! Умножение на константу.
-	quaternion operator* (long double num) const {
-		return quaternion (w*num, x*num, y*num, z*num);
+	BOOST_CONSTEXPR basic_quaternion operator* (T num) const BOOST_NOEXCEPT {
+		return basic_quaternion (w*num, x*num, y*num, z*num);
 	}
 
 	//! Деление на константу.
-	quaternion operator/ (long double num) const {
-		return quaternion (w/num, x/num, y/num, z/num);
+	BOOST_CONSTEXPR basic_quaternion operator/ (T num) const BOOST_NOEXCEPT {
+		return basic_quaternion (w/num, x/num, y/num, z/num);
 	}
 
-	//! Кватернионное произведение.
-	quaternion operator* (const quaternion & q) const {
-		quaternion result;
-		result.w = w * q.w - x * q.x - y * q.y - z * q.z;
-		result.x = w * q.x + x * q.w + y * q.z - z * q.y;
-		result.y = w * q.y - x * q.z + y * q.w + z * q.x;
-		result.z = w * q.z + x * q.y - y * q.x + z * q.w;
-		return result;
+	//! Кватернионное произведение (см. quaternion_kernels).
+	BOOST_CXX14_CONSTEXPR basic_quaternion operator* (const basic_quaternion & q) const BOOST_NOEXCEPT {
+		return quaternion_kernels<T>::multiply (*this, q);
 	}
 
-	quaternion operator- () const {
-		return quaternion (-w, -x, -y, -z);
+	BOOST_CONSTEXPR basic_quaternion operator- () const BOOST_NOEXCEPT {
+		return basic_quaternion (-w, -x, -y, -z);
 	}
 	
 
-	quaternion & operator+= (const quaternion & q) {
-		*this = *this + q;
+	BOOST_CXX14_CONSTEXPR basic_quaternion & operator+= (const basic_quaternion & q) BOOST_NOEXCEPT {
+		w += q.w;
+		x += q.x;
+		y += q.y;
+		z += q.z;
+		return *this;
+	}
+
+	BOOST_CXX14_CONSTEXPR basic_quaternion & operator-= (const basic_quaternion & q) BOOST_NOEXCEPT {
+		w -= q.w;
+		x -= q.x;
+		y -= q.y;
+		z -= q.z;
 		return *this;
 	}
 
-	quaternion & operator-= (const quaternion & q) {
-		*this = *this - q;
+	BOOST_CXX14_CONSTEXPR basic_quaternion & operator*= (T num) BOOST_NOEXCEPT {
+		w *= num;
+		x *= num;
+		y *= num;
+		z *= num;
 		return *this;
 	}
 
-	quaternion & operator*= (long double num) {
-		*this = *this * num;
+	BOOST_CXX14_CONSTEXPR basic_quaternion & operator/= (T num) BOOST_NOEXCEPT {
+		w /= num;
+		x /= num;
+		y /= num;
+		z /= num;
 		return *this;
 	}
 
-	quaternion & operator/= (long double num) {
-		*this = *this / num;
+	//! Умножение справа на кватернион q: *this = *this * q.
+	BOOST_CXX14_CONSTEXPR basic_quaternion & operator*= (const basic_quaternion & q) BOOST_NOEXCEPT {
+		*this = quaternion_kernels<T>::multiply (*this, q);
 		return *this;
 	}
 
 
 	//! Сопряжённый кватернион.
-	quaternion conjugate() const {
-		return quaternion (w, -x, -y, -z);
+	BOOST_CONSTEXPR basic_quaternion conjugate() const BOOST_NOEXCEPT {
+		return basic_quaternion (w, -x, -y, -z);
 	}
 
 	//! Обратный кватернион - умножение на который слева/справа эквивалентно делению слева/справа на исходный кватернион.
-	quaternion inverse() const {
+	BOOST_CONSTEXPR basic_quaternion inverse() const BOOST_NOEXCEPT {
 		return conjugate() * (1 / norm());
 	}
 
 	
-	bool operator== (const quaternion & q) const {
+	bool operator== (const basic_quaternion & q) const BOOST_NOEXCEPT {
 		return abs (w - q.w) < EPS && abs (x - q.x) < EPS && abs (y - q.y) < EPS && abs (z - q.z) < EPS;
 	}
 
 
 	//! Возвращает норму кватерниона - сумму квадратов компонент.
-	long double norm() const {
+	BOOST_CONSTEXPR T norm() const BOOST_NOEXCEPT {
 		return w*w + x*x + y*y + z*z;
 	}
 
 	//! Возвращает длину (тензор) кватерниона - квадратный корень из суммы квадратов компонент.
-	long double length() const {
+	T length() const BOOST_NOEXCEPT {
 		return sqrt (norm());
 	}
 
 
 	//! Возвращает единичный кватернион.
-	static quaternion get_unit() {
-		return quaternion (1);
+	static BOOST_CONSTEXPR basic_quaternion get_unit() BOOST_NOEXCEPT {
+		return basic_quaternion (1);
 	}
 
 
-}; // class quaternion
+}; // class basic_quaternion
 
 
 
-inline quaternion operator+ (long double a, const quaternion & b) {
+//! Кватернион с компонентами типа long double.
+typedef basic_quaternion<long double> quaternion;
+
+
+
+template <typename T>
+inline BOOST_CONSTEXPR basic_quaternion<T> operator+ (typename basic_quaternion<T>::value_type a, const basic_quaternion<T> & b) BOOST_NOEXCEPT {
 	return b + a;
 }
 
-inline quaternion operator- (long double a, const quaternion & b) {
-	return quaternion (a-b.w, -b.x, -b.y, -b.z);
+template <typename T>
+inline BOOST_CONSTEXPR basic_quaternion<T> operator- (typename basic_quaternion<T>::value_type a, const basic_quaternion<T> & b) BOOST_NOEXCEPT {
+	return basic_quaternion<T> (a-b.w, -b.x, -b.y, -b.z);
 }
 
-inline quaternion operator* (long double a, const quaternion & b) {
+template <typename T>
+inline BOOST_CONSTEXPR basic_quaternion<T> operator* (typename basic_quaternion<T>::value_type a, const basic_quaternion<T> & b) BOOST_NOEXCEPT {
 	return b * a;
 }
 
 
 
+/** Класс "scalar_quaternion_kernels" - основные операции над кватернионами, записанные покомпонентно.
+ *
+ * Это реализация quaternion_kernels по умолчанию; для double и float
+ * могут быть выбраны векторные реализации (см. quaternion_simd.hpp),
+ * дающие те же результаты.
+ *
+ * @tparam T Тип компонент кватернионов.
+ */
+template <typename T>
+class scalar_quaternion_kernels {
+
+public:
+
+
+	//! Возвращает название используемого набора инструкций.
+	static const char * get_instruction_set() {
+		return "scalar";
+	}
+
+
+	//! Возвращает произведение a * b.
+	static BOOST_CXX14_CONSTEXPR basic_quaternion<T> multiply (const basic_quaternion<T> & a, const basic_quaternion<T> & b) BOOST_NOEXCEPT {
+		basic_quaternion<T> result;
+		result.w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+		result.x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y;
+		result.y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x;
+		result.z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w;
+		return result;
+	}
+
+	//! Возвращает произведение сопряжённого к a кватерниона на b.
+	static BOOST_CXX14_CONSTEXPR basic_quaternion<T> conjugate_multiply (const basic_quaternion<T> & a, const basic_quaternion<T> & b) BOOST_NOEXCEPT {
+		return multiply (a.conjugate(), b);
+	}
+
+	//! Возвращает нормированный кватернион q.
+	static basic_quaternion<T> normalize (const basic_quaternion<T> & q) {
+		return q * (1 / q.length());
+	}
+
+	//! Возвращает модуль разности кватернионов a и b.
+	static T distance (const basic_quaternion<T> & a, const basic_quaternion<T> & b) {
+		return (a-b).length();
+	}
+
+
+}; // class scalar_quaternion_kernels
+
+
+
+/** Класс "quaternion_kernels" - реализация основных операций над кватернионами, выбираемая на этапе компиляции.
+ *
+ * Через этот класс вычисляются произведение кватернионов, а также функции
+ * conjugate_multiply(), normalize() и distance(). В общем случае операции
+ * записаны покомпонентно (см. scalar_quaternion_kernels); специализации
+ * для double и float на SSE2/AVX находятся в quaternion_simd.hpp.
+ *
+ * @tparam T Тип компонент кватернионов.
+ */
+template <typename T>
+class quaternion_kernels : public scalar_quaternion_kernels<T> {
+}; // class quaternion_kernels
+
+
+
+//! Возвращает произведение сопряжённого к a кватерниона на b - т.е. a.conjugate() * b.
+template <typename T>
+inline basic_quaternion<T> conjugate_multiply (const basic_quaternion<T> & a, const basic_quaternion<T> & b) {
+	return quaternion_kernels<T>::conjugate_multiply (a, b);
+}
+
+
 //! Возвращает расстояние между кватернионами - т.е. модуль их разности.
-inline long double distance (const quaternion & a, const quaternion & b) {
-	return (a-b).length();
+template <typename T>
+inline T distance (const basic_quaternion<T> & a, const basic_quaternion<T> & b) {
+	return quaternion_kernels<T>::distance (a, b);
+}
+
+
+//! Возвращает нормированный кватернион - т.е. кватернион единичной длины того же направления.
+template <typename T>
+inline basic_quaternion<T> normalize (const basic_quaternion<T> & q) {
+	return quaternion_kernels<T>::normalize (q);
 }
 
 
 //! Вывод кватерниона.
-std::ostream & operator<< (std::ostream & stream, const quaternion & q) {
+template <typename T>
+inline std::ostream & operator<< (std::ostream & stream, const basic_quaternion<T> & q) {
 	return stream << q.w << ' ' << q.x << ' ' << q.y << ' ' << q.z << ' ';
 }
 
 
 
+
+#include "quaternion_simd.hpp"
+
+
+
 #endif // ifndef TYPES_QUATERNION_H
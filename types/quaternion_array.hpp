@@ -0,0 +1,240 @@
+/** \file quaternion_array.hpp
+    \brief Содержит класс "массив кватернионов" - хранилище кватернионов по компонентам (structure of arrays).
+*/
+
+#pragma once
+#ifndef TYPES_QUATERNION_ARRAY_H
+#define TYPES_QUATERNION_ARRAY_H
+
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "plane_angles.hpp"
+#include "quaternion.hpp"
+
+
+
+/** Класс "Массив кватернионов".
+ *
+ * Компоненты кватернионов хранятся в четырёх отдельных массивах w, x, y, z
+ * (а не кватернион за кватернионом, как в std::vector<basic_quaternion<T> >),
+ * поэтому пакетные операции над всей траекторией (см. batch_multiply(),
+ * batch_distance(), batch_normalize()) компилятор может векторизовать.
+ *
+ * Интерфейс доступа к элементам повторяет std::vector; запись отдельного
+ * элемента идёт через промежуточный объект reference.
+ *
+ * @tparam T Тип компонент (float, double, long double).
+ */
+template <typename T>
+class basic_quaternion_array {
+
+public:
+
+
+	//! Тип элемента массива.
+	typedef basic_quaternion<T> value_type;
+
+
+	/** Ссылка на элемент массива.
+	 *
+	 * Позволяет писать a[i] = q и читать q = a[i], как для std::vector.
+	 * Методы элемента через ссылку не вызываются - для этого элемент надо
+	 * сначала прочитать (или воспользоваться get()).
+	 */
+	class reference {
+
+	public:
+
+		reference (basic_quaternion_array & owner, size_t idx)
+			: owner_ (owner),
+			  idx_ (idx)
+		{ }
+
+		reference & operator= (const value_type & q) {
+			owner_.set (idx_, q);
+			return *this;
+		}
+
+		reference & operator= (const reference & r) {
+			owner_.set (idx_, r.owner_.get (r.idx_));
+			return *this;
+		}
+
+		operator value_type() const {
+			return owner_.get (idx_);
+		}
+
+	private:
+
+		basic_quaternion_array & owner_;
+		size_t idx_;
+
+	}; // class reference
+
+
+	/** Компоненты кватернионов. */
+	//@{
+	std::vector<T> w, x, y, z;
+	//@}
+
+
+	//! Конструктор пустого массива.
+	basic_quaternion_array()
+	{ }
+
+	//! Конструктор массива из count нулевых кватернионов.
+	explicit basic_quaternion_array (size_t count)
+		: w (count), x (count), y (count), z (count)
+	{ }
+
+
+	//! Возвращает число кватернионов в массиве.
+	size_t size() const {
+		return w.size();
+	}
+
+	//! Меняет число кватернионов в массиве (новые кватернионы - нулевые).
+	void resize (size_t count) {
+		w.resize (count);
+		x.resize (count);
+		y.resize (count);
+		z.resize (count);
+	}
+
+	//! Выделяет память под count кватернионов.
+	void reserve (size_t count) {
+		w.reserve (count);
+		x.reserve (count);
+		y.reserve (count);
+		z.reserve (count);
+	}
+
+	//! Добавляет кватернион в конец массива.
+	void push_back (const value_type & q) {
+		w.push_back (q.w);
+		x.push_back (q.x);
+		y.push_back (q.y);
+		z.push_back (q.z);
+	}
+
+
+	//! Возвращает кватернион с индексом idx.
+	value_type get (size_t idx) const {
+		return value_type (w[idx], x[idx], y[idx], z[idx]);
+	}
+
+	//! Записывает кватернион q в элемент с индексом idx.
+	void set (size_t idx, const value_type & q) {
+		w[idx] = q.w;
+		x[idx] = q.x;
+		y[idx] = q.y;
+		z[idx] = q.z;
+	}
+
+	value_type operator[] (size_t idx) const {
+		return get (idx);
+	}
+
+	reference operator[] (size_t idx) {
+		return reference (*this, idx);
+	}
+
+
+}; // class basic_quaternion_array
+
+
+
+//! Массив кватернионов с компонентами типа long double.
+typedef basic_quaternion_array<long double> quaternion_array;
+
+
+
+/** Вычисляет произведения a[i] * b[i] для всех i.
+ *
+ * Массивы a и b должны быть одинакового размера; result может совпадать
+ * с a или b. Формулы те же, что и в basic_quaternion::operator*().
+ *
+ * Произведения считаются блоками по block элементов в локальный буфер:
+ * так компилятор видит, что запись результата не пересекается с
+ * сомножителями, и векторизует цикл без проверок на перекрытие.
+ */
+template <typename T>
+void batch_multiply (const basic_quaternion_array<T> & a, const basic_quaternion_array<T> & b, basic_quaternion_array<T> & result) {
+	const size_t block = 64;
+	size_t count = a.size();
+	result.resize (count);
+
+	T rw[block], rx[block], ry[block], rz[block];
+	for (size_t first=0; first<count; first+=block) {
+		size_t n = std::min (block, count - first);
+		const T * aw = &a.w[first], * ax = &a.x[first], * ay = &a.y[first], * az = &a.z[first],
+			* bw = &b.w[first], * bx = &b.x[first], * by = &b.y[first], * bz = &b.z[first];
+		for (size_t i=0; i<n; ++i) {
+			rw[i] = aw[i] * bw[i] - ax[i] * bx[i] - ay[i] * by[i] - az[i] * bz[i];
+			rx[i] = aw[i] * bx[i] + ax[i] * bw[i] + ay[i] * bz[i] - az[i] * by[i];
+			ry[i] = aw[i] * by[i] - ax[i] * bz[i] + ay[i] * bw[i] + az[i] * bx[i];
+			rz[i] = aw[i] * bz[i] + ax[i] * by[i] - ay[i] * bx[i] + az[i] * bw[i];
+		}
+		std::copy (rw, rw + n, &result.w[first]);
+		std::copy (rx, rx + n, &result.x[first]);
+		std::copy (ry, ry + n, &result.y[first]);
+		std::copy (rz, rz + n, &result.z[first]);
+	}
+}
+
+
+/** Вычисляет расстояния между a[i] и b[i] для всех i (см. distance()).
+ *
+ * Массивы a и b должны быть одинакового размера.
+ */
+template <typename T>
+void batch_distance (const basic_quaternion_array<T> & a, const basic_quaternion_array<T> & b, std::vector<T> & result) {
+	size_t count = a.size();
+	result.resize (count);
+	for (size_t i=0; i<count; ++i) {
+		T dw = a.w[i] - b.w[i], dx = a.x[i] - b.x[i], dy = a.y[i] - b.y[i], dz = a.z[i] - b.z[i];
+		result[i] = sqrt (dw*dw + dx*dx + dy*dy + dz*dz);
+	}
+}
+
+
+//! Нормирует все кватернионы массива a (на месте, см. normalize()).
+template <typename T>
+void batch_normalize (basic_quaternion_array<T> & a) {
+	size_t count = a.size();
+	for (size_t i=0; i<count; ++i) {
+		T length = sqrt (a.w[i] * a.w[i] + a.x[i] * a.x[i] + a.y[i] * a.y[i] + a.z[i] * a.z[i]);
+		T factor = 1 / length;
+		a.w[i] *= factor;
+		a.x[i] *= factor;
+		a.y[i] *= factor;
+		a.z[i] *= factor;
+	}
+}
+
+
+//! Переводит все кватернионы массива a в самолётные углы.
+template <typename T>
+void to_plane_angles (const basic_quaternion_array<T> & a, std::vector< basic_plane_angles<T> > & result) {
+	size_t count = a.size();
+	result.resize (count);
+	for (size_t i=0; i<count; ++i)
+		result[i] = basic_plane_angles<T> (a.get (i));
+}
+
+
+//! Переводит все самолётные углы angles в кватернионы.
+template <typename T>
+void from_plane_angles (const std::vector< basic_plane_angles<T> > & angles, basic_quaternion_array<T> & result) {
+	size_t count = angles.size();
+	result.resize (count);
+	for (size_t i=0; i<count; ++i)
+		result.set (i, basic_quaternion<T> (angles[i]));
+}
+
+
+
+#endif // ifndef TYPES_QUATERNION_ARRAY_H
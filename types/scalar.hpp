@@ -0,0 +1,78 @@
+/** \file scalar.hpp
+    \brief Содержит математические функции для скалярного типа __float128 (если компилятор его поддерживает).
+
+	Типы из каталога types параметризуются типом компонент (float, double,
+	long double). Для эталонных расчётов можно использовать и __float128, но
+	для него стандартные функции sin, cos, sqrt и т.д. не определены - здесь
+	они определяются через libquadmath (при их использовании программу
+	нужно собирать с -lquadmath).
+
+	Кроме того, в глобальную область видимости вносятся перегрузки из std
+	(std::sqrt, std::sin и т.д.): без них неквалифицированный вызов, скажем,
+	sqrt от long double в шаблонах из types находит только ::sqrt (double) из
+	C и молча теряет точность.
+
+	Функции для __float128 объявлены шаблонами, которые участвуют в
+	перегрузке только для __float128, поэтому они не конкурируют с
+	перегрузками из std для float, double и long double.
+*/
+
+#pragma once
+#ifndef TYPES_SCALAR_H
+#define TYPES_SCALAR_H
+
+
+
+#include <cmath>
+#include <cstdlib>
+
+
+
+using std::sqrt;
+using std::sin;
+using std::cos;
+using std::tan;
+using std::asin;
+using std::acos;
+using std::atan;
+using std::atan2;
+using std::exp;
+using std::log;
+using std::fabs;
+using std::abs;
+using std::pow;
+
+
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__SIZEOF_FLOAT128__)
+
+#define TYPES_HAS_FLOAT128 1
+
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <quadmath.h>
+
+
+
+//! Тип результата функций из данного файла: __float128, если T - это __float128, иначе функция исключается из перегрузки.
+#define TYPES_FLOAT128_RESULT(T) typename boost::enable_if < boost::is_same < T, __float128 >, T >::type
+
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) sqrt (T x)  { return sqrtq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) sin (T x)  { return sinq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) cos (T x)  { return cosq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) tan (T x)  { return tanq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) asin (T x)  { return asinq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) atan (T x)  { return atanq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) exp (T x)  { return expq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) log (T x)  { return logq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) fabs (T x)  { return fabsq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) abs (T x)  { return fabsq (x); }
+template <typename T>  inline TYPES_FLOAT128_RESULT(T) pow (T x, int n)  { return powq (x, n); }
+
+#undef TYPES_FLOAT128_RESULT
+
+#endif
+
+
+
+#endif // ifndef TYPES_SCALAR_H
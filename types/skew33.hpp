@@ -0,0 +1,171 @@
+/** \file skew33.hpp
+    \brief Содержит класс "кососимметричная матрица 3x3".
+*/
+
+#pragma once
+#ifndef TYPES_SKEW33_H
+#define TYPES_SKEW33_H
+
+
+
+#include <stdexcept>
+#include <boost/config.hpp>
+#include "matrix33.hpp"
+#include "vector3.hpp"
+
+
+
+/** Класс "Кососимметричная матрица 3x3".
+ *
+ * Матрица векторного умножения на вектор v:
+ *
+ *        |   0   -v.z   v.y |
+ *  [v] = |  v.z    0   -v.x |
+ *        | -v.y   v.x    0  |
+ *
+ * Хранится только вектор v. Произведение на вектор u - это векторное
+ * произведение v x u, произведение двух кососимметричных матриц
+ * выражается через попарные произведения компонент (см. operator*()).
+ * Результаты совпадают побитово с вычислением через basic_matrix33.
+ *
+ * @tparam T Тип компонент (float, double, long double, __float128 - см. scalar.hpp).
+ */
+template <typename T>
+class basic_skew33 {
+
+public:
+
+
+	//! Тип элементов матрицы.
+	typedef T value_type;
+
+
+	//! Вектор, задающий матрицу.
+	basic_vector3<T> v;
+
+
+	//! Конструктор нулевой матрицы.
+	BOOST_CONSTEXPR basic_skew33() BOOST_NOEXCEPT
+		: v()
+	{ }
+
+	//! Конструктор матрицы векторного умножения на вектор v.
+	explicit BOOST_CONSTEXPR basic_skew33 (const basic_vector3<T> & v) BOOST_NOEXCEPT
+		: v(v)
+	{ }
+
+
+	/** Индексированный доступ к элементам матрицы.
+	 *
+	 * Индексы проверяются только в отладочной сборке (без NDEBUG).
+	 *
+	 * @throws std::invalid_argument В случае, если передано некорректное значение row или column (только в отладочной сборке).
+	 */
+	BOOST_CXX14_CONSTEXPR T operator() (int row, int column) const {
+#ifndef NDEBUG
+		if (row < 0 || row >= 3)
+			throw std::invalid_argument ("Invalid row value.");
+		if (column < 0 || column >= 3)
+			throw std::invalid_argument ("Invalid column value.");
+#endif
+		if (row == column)
+			return 0;
+		// элемент (row, column) - это ±v[k], где k - третий индекс
+		int k = 3 - row - column;
+		return (column - row + 3) % 3 == 1 ? -v[k] : v[k];
+	}
+
+	//! Преобразование к матрице общего вида.
+	BOOST_CXX14_CONSTEXPR operator basic_matrix33<T>() const BOOST_NOEXCEPT {
+		return basic_matrix33<T> (
+			   0, -v.z,  v.y,
+			 v.z,    0, -v.x,
+			-v.y,  v.x,    0
+		);
+	}
+
+
+	BOOST_CONSTEXPR basic_skew33 operator+ (const basic_skew33 & m) const BOOST_NOEXCEPT {
+		return basic_skew33 (v + m.v);
+	}
+
+	BOOST_CONSTEXPR basic_skew33 operator- (const basic_skew33 & m) const BOOST_NOEXCEPT {
+		return basic_skew33 (v - m.v);
+	}
+
+	//! Умножение на константу.
+	BOOST_CONSTEXPR basic_skew33 operator* (T num) const BOOST_NOEXCEPT {
+		return basic_skew33 (v * num);
+	}
+
+	//! Деление на константу.
+	BOOST_CONSTEXPR basic_skew33 operator/ (T num) const BOOST_NOEXCEPT {
+		return basic_skew33 (v / num);
+	}
+
+	//! Унарный минус.
+	BOOST_CONSTEXPR basic_skew33 operator- () const BOOST_NOEXCEPT {
+		return basic_skew33 (-v);
+	}
+
+	//! Умножение на вектор - векторное произведение v x u.
+	BOOST_CONSTEXPR basic_vector3<T> operator* (const basic_vector3<T> & u) const BOOST_NOEXCEPT {
+		return v.crossProduct (u);
+	}
+
+	/** Матричное произведение [v] * [u] = u v^T - (v, u) E.
+	 *
+	 * Диагональные элементы складываются в том же порядке, что и в
+	 * basic_matrix33::operator*(), поэтому результат совпадает побитово.
+	 */
+	BOOST_CXX14_CONSTEXPR basic_matrix33<T> operator* (const basic_skew33 & m) const BOOST_NOEXCEPT {
+		const basic_vector3<T> & u = m.v;
+		return basic_matrix33<T> (
+			-(v.z * u.z + v.y * u.y),   v.y * u.x,                 v.z * u.x,
+			  v.x * u.y,               -(v.z * u.z + v.x * u.x),   v.z * u.y,
+			  v.x * u.z,                 v.y * u.z,               -(v.y * u.y + v.x * u.x)
+		);
+	}
+
+
+	BOOST_CXX14_CONSTEXPR basic_skew33 & operator+= (const basic_skew33 & m) BOOST_NOEXCEPT {
+		v += m.v;
+		return *this;
+	}
+
+	BOOST_CXX14_CONSTEXPR basic_skew33 & operator-= (const basic_skew33 & m) BOOST_NOEXCEPT {
+		v -= m.v;
+		return *this;
+	}
+
+	//! Умножение на константу.
+	BOOST_CXX14_CONSTEXPR basic_skew33 & operator*= (T num) BOOST_NOEXCEPT {
+		v *= num;
+		return *this;
+	}
+
+	//! Деление на константу.
+	BOOST_CXX14_CONSTEXPR basic_skew33 & operator/= (T num) BOOST_NOEXCEPT {
+		v /= num;
+		return *this;
+	}
+
+
+}; // class basic_skew33
+
+
+
+//! Кососимметричная матрица 3x3 с элементами типа long double.
+typedef basic_skew33<long double> skew33;
+
+
+
+//! Умножение на константу
+template <typename T>
+inline BOOST_CONSTEXPR basic_skew33<T> operator* (typename basic_skew33<T>::value_type num, const basic_skew33<T> & m) BOOST_NOEXCEPT {
+	return m * num;
+}
+
+
+
+#endif // ifndef TYPES_SKEW33_H
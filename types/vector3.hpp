@@ -10,104 +10,140 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <boost/config.hpp>
+#include "scalar.hpp"
 
 
 
-//! Класс "Трёхмерный вектор".
-class vector3 {
+/** Класс "Трёхмерный вектор".
+ *
+ * @tparam T Тип компонент (float, double, long double, __float128 - см. scalar.hpp).
+ */
+template <typename T>
+class basic_vector3 {
 
 public:
 
+
+	//! Тип компонент вектора.
+	typedef T value_type;
+
 	
 	/** Компоненты вектора. */
 	//@{
-	long double x, y, z;
+	T x, y, z;
 	//@}
 
 	
 	//! Конструктор нулевого вектора.
-	vector3()
+	BOOST_CONSTEXPR basic_vector3() BOOST_NOEXCEPT
 		: x(0), y(0), z(0)
 	{ }
 
-	vector3 (long double x, long double y, long double z)
+	BOOST_CONSTEXPR basic_vector3 (T x, T y, T z) BOOST_NOEXCEPT
 		: x(x), y(y), z(z)
 	{ }
 
-	vector3 (const vector3 & v)
-		: x(v.x), y(v.y), z(v.z)
+	//! Конструктор из вектора с компонентами другого типа.
+	template <typename U>
+	explicit BOOST_CONSTEXPR basic_vector3 (const basic_vector3<U> & v) BOOST_NOEXCEPT
+		: x(T(v.x)), y(T(v.y)), z(T(v.z))
 	{ }
 
 
 	/** Индексированный доступ к компонентам вектора.
 	 *
-	 * @throws std::invalid_argument В случае, если передано некорректное значение idx.
+	 * Индекс проверяется только в отладочной сборке (без NDEBUG).
+	 *
+	 * @throws std::invalid_argument В случае, если передано некорректное значение idx (только в отладочной сборке).
 	 */
-	long double operator[] (int idx) const {
+	BOOST_CXX14_CONSTEXPR T operator[] (int idx) const {
 		if (idx == 0)  return x;
 		if (idx == 1)  return y;
-		if (idx == 2)  return z;
-		throw std::invalid_argument ("Invalid idx value.");
+#ifndef NDEBUG
+		if (idx != 2)
+			throw std::invalid_argument ("Invalid idx value.");
+#endif
+		return z;
 	}
 
 	/** Индексированный доступ к компонентам вектора.
 	 *
-	 * @throws std::invalid_argument В случае, если передано некорректное значение idx.
+	 * Индекс проверяется только в отладочной сборке (без NDEBUG).
+	 *
+	 * @throws std::invalid_argument В случае, если передано некорректное значение idx (только в отладочной сборке).
 	 */
-	long double & operator[] (int idx) {
+	BOOST_CXX14_CONSTEXPR T & operator[] (int idx) {
 		if (idx == 0)  return x;
 		if (idx == 1)  return y;
-		if (idx == 2)  return z;
-		throw std::invalid_argument ("Invalid idx value.");
+#ifndef NDEBUG
+		if (idx != 2)
+			throw std::invalid_argument ("Invalid idx value.");
+#endif
+		return z;
 	}
 
 	
-	vector3 operator+ (const vector3 & v) const {
-		return vector3 (x+v.x, y+v.y, z+v.z);
+	BOOST_CONSTEXPR basic_vector3 operator+ (const basic_vector3 & v) const BOOST_NOEXCEPT {
+		return basic_vector3 (x+v.x, y+v.y, z+v.z);
 	}
 
-	vector3 operator- (const vector3 & v) const {
-		return vector3 (x-v.x, y-v.y, z-v.z);
+	BOOST_CONSTEXPR basic_vector3 operator- (const basic_vector3 & v) const BOOST_NOEXCEPT {
+		return basic_vector3 (x-v.x, y-v.y, z-v.z);
 	}
 
 	//! Умножение на константу.
-	vector3 operator* (long double num) const {
-		return vector3 (x*num, y*num, z*num);
+	BOOST_CONSTEXPR basic_vector3 operator* (T num) const BOOST_NOEXCEPT {
+		return basic_vector3 (x*num, y*num, z*num);
 	}
 
 	//! Деление на константу.
-	vector3 operator/ (long double num) const {
-		return vector3 (x/num, y/num, z/num);
+	BOOST_CONSTEXPR basic_vector3 operator/ (T num) const BOOST_NOEXCEPT {
+		return basic_vector3 (x/num, y/num, z/num);
 	}
 
 	//! Унарный минус.
-	vector3 operator- () const {
-		return vector3 (-x, -y, -z);
+	BOOST_CONSTEXPR basic_vector3 operator- () const BOOST_NOEXCEPT {
+		return basic_vector3 (-x, -y, -z);
 	}
 
-	vector3 & operator+= (const vector3 & v) {
+	BOOST_CXX14_CONSTEXPR basic_vector3 & operator+= (const basic_vector3 & v) BOOST_NOEXCEPT {
 		x += v.x;
 		y += v.y;
 		z += v.z;
 		return *this;
 	}
 
-	vector3 & operator-= (const vector3 & v) {
+	BOOST_CXX14_CONSTEXPR basic_vector3 & operator-= (const basic_vector3 & v) BOOST_NOEXCEPT {
 		x -= v.x;
 		y -= v.y;
 		z -= v.z;
 		return *this;
 	}
 
+	BOOST_CXX14_CONSTEXPR basic_vector3 & operator*= (T num) BOOST_NOEXCEPT {
+		x *= num;
+		y *= num;
+		z *= num;
+		return *this;
+	}
+
+	BOOST_CXX14_CONSTEXPR basic_vector3 & operator/= (T num) BOOST_NOEXCEPT {
+		x /= num;
+		y /= num;
+		z /= num;
+		return *this;
+	}
+
 
 	//! Скалярное произведение.
-	long double dotProduct (const vector3 & v) const {
+	BOOST_CONSTEXPR T dotProduct (const basic_vector3 & v) const BOOST_NOEXCEPT {
 		return x * v.x + y * v.y + z * v.z;
 	}
 
 	//! Векторное произведение.
-	vector3 crossProduct (const vector3 & v) const {
-		return vector3 (
+	BOOST_CONSTEXPR basic_vector3 crossProduct (const basic_vector3 & v) const BOOST_NOEXCEPT {
+		return basic_vector3 (
 			y * v.z - z * v.y,
 			z * v.x - x * v.z,
 			x * v.y - y * v.x
@@ -116,37 +152,46 @@ public:
 
 
 	//! Возвращает норму вектора - сумму квадратов компонент.
-	long double norm() const {
+	BOOST_CONSTEXPR T norm() const BOOST_NOEXCEPT {
 		return x*x + y*y + z*z;
 	}
 
 	//! Возвращает длину (тензор) вектора - квадратный корень из суммы квадратов компонент.
-	long double length() const {
+	T length() const BOOST_NOEXCEPT {
 		return sqrt (norm());
 	}
 
 
-}; // class vector3
+}; // class basic_vector3
+
+
+
+//! Трёхмерный вектор с компонентами типа long double.
+typedef basic_vector3<long double> vector3;
 
 
 
 //! Умножение на константу
-inline vector3 operator* (long double num, const vector3 & v) {
+template <typename T>
+inline BOOST_CONSTEXPR basic_vector3<T> operator* (typename basic_vector3<T>::value_type num, const basic_vector3<T> & v) BOOST_NOEXCEPT {
 	return v * num;
 }
 
 //! Возвращает расстояние между векторами - т.е. модуль их разности.
-inline long double distance (const vector3 & a, const vector3 & b) {
+template <typename T>
+inline T distance (const basic_vector3<T> & a, const basic_vector3<T> & b) {
 	return (a-b).length();
 }
 
 //! Скалярное произведение.
-inline long double dotProduct (const vector3 & a, const vector3 & b) {
+template <typename T>
+inline BOOST_CONSTEXPR T dotProduct (const basic_vector3<T> & a, const basic_vector3<T> & b) BOOST_NOEXCEPT {
 	return a.dotProduct (b);
 }
 
 //! Векторное произведение.
-inline vector3 crossProduct (const vector3 & a, const vector3 & b) {
+template <typename T>
+inline BOOST_CONSTEXPR basic_vector3<T> crossProduct (const basic_vector3<T> & a, const basic_vector3<T> & b) BOOST_NOEXCEPT {
 	return a.crossProduct (b);
 }
 
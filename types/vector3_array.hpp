@@ -0,0 +1,186 @@
+/** \file vector3_array.hpp
+    \brief Содержит класс "массив трёхмерных векторов" - хранилище векторов по компонентам (structure of arrays).
+*/
+
+#pragma once
+#ifndef TYPES_VECTOR3_ARRAY_H
+#define TYPES_VECTOR3_ARRAY_H
+
+
+
+#include <cmath>
+#include <vector>
+#include "vector3.hpp"
+
+
+
+/** Класс "Массив трёхмерных векторов".
+ *
+ * Компоненты векторов хранятся в трёх отдельных массивах x, y, z (а не
+ * вектор за вектором, как в std::vector<basic_vector3<T> >), поэтому
+ * пакетные операции над всем массивом (см. batch_dot(), batch_length(),
+ * batch_normalize()) компилятор может векторизовать.
+ *
+ * Интерфейс доступа к элементам повторяет std::vector; запись отдельного
+ * элемента идёт через промежуточный объект reference.
+ *
+ * @tparam T Тип компонент (float, double, long double).
+ */
+template <typename T>
+class basic_vector3_array {
+
+public:
+
+
+	//! Тип элемента массива.
+	typedef basic_vector3<T> value_type;
+
+
+	/** Ссылка на элемент массива.
+	 *
+	 * Позволяет писать a[i] = v и читать v = a[i], как для std::vector.
+	 * Методы элемента через ссылку не вызываются - для этого элемент надо
+	 * сначала прочитать (или воспользоваться get()).
+	 */
+	class reference {
+
+	public:
+
+		reference (basic_vector3_array & owner, size_t idx)
+			: owner_ (owner),
+			  idx_ (idx)
+		{ }
+
+		reference & operator= (const value_type & v) {
+			owner_.set (idx_, v);
+			return *this;
+		}
+
+		reference & operator= (const reference & r) {
+			owner_.set (idx_, r.owner_.get (r.idx_));
+			return *this;
+		}
+
+		operator value_type() const {
+			return owner_.get (idx_);
+		}
+
+	private:
+
+		basic_vector3_array & owner_;
+		size_t idx_;
+
+	}; // class reference
+
+
+	/** Компоненты векторов. */
+	//@{
+	std::vector<T> x, y, z;
+	//@}
+
+
+	//! Конструктор пустого массива.
+	basic_vector3_array()
+	{ }
+
+	//! Конструктор массива из count нулевых векторов.
+	explicit basic_vector3_array (size_t count)
+		: x (count), y (count), z (count)
+	{ }
+
+
+	//! Возвращает число векторов в массиве.
+	size_t size() const {
+		return x.size();
+	}
+
+	//! Меняет число векторов в массиве (новые векторы - нулевые).
+	void resize (size_t count) {
+		x.resize (count);
+		y.resize (count);
+		z.resize (count);
+	}
+
+	//! Выделяет память под count векторов.
+	void reserve (size_t count) {
+		x.reserve (count);
+		y.reserve (count);
+		z.reserve (count);
+	}
+
+	//! Добавляет вектор в конец массива.
+	void push_back (const value_type & v) {
+		x.push_back (v.x);
+		y.push_back (v.y);
+		z.push_back (v.z);
+	}
+
+
+	//! Возвращает вектор с индексом idx.
+	value_type get (size_t idx) const {
+		return value_type (x[idx], y[idx], z[idx]);
+	}
+
+	//! Записывает вектор v в элемент с индексом idx.
+	void set (size_t idx, const value_type & v) {
+		x[idx] = v.x;
+		y[idx] = v.y;
+		z[idx] = v.z;
+	}
+
+	value_type operator[] (size_t idx) const {
+		return get (idx);
+	}
+
+	reference operator[] (size_t idx) {
+		return reference (*this, idx);
+	}
+
+
+}; // class basic_vector3_array
+
+
+
+//! Массив векторов с компонентами типа long double.
+typedef basic_vector3_array<long double> vector3_array;
+
+
+
+/** Вычисляет скалярные произведения a[i] * b[i] для всех i.
+ *
+ * Массивы a и b должны быть одинакового размера.
+ */
+template <typename T>
+void batch_dot (const basic_vector3_array<T> & a, const basic_vector3_array<T> & b, std::vector<T> & result) {
+	size_t count = a.size();
+	result.resize (count);
+	for (size_t i=0; i<count; ++i)
+		result[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+}
+
+
+//! Вычисляет длины всех векторов массива a.
+template <typename T>
+void batch_length (const basic_vector3_array<T> & a, std::vector<T> & result) {
+	size_t count = a.size();
+	result.resize (count);
+	for (size_t i=0; i<count; ++i)
+		result[i] = sqrt (a.x[i] * a.x[i] + a.y[i] * a.y[i] + a.z[i] * a.z[i]);
+}
+
+
+//! Нормирует все векторы массива a (на месте).
+template <typename T>
+void batch_normalize (basic_vector3_array<T> & a) {
+	size_t count = a.size();
+	for (size_t i=0; i<count; ++i) {
+		T factor = 1 / sqrt (a.x[i] * a.x[i] + a.y[i] * a.y[i] + a.z[i] * a.z[i]);
+		a.x[i] *= factor;
+		a.y[i] *= factor;
+		a.z[i] *= factor;
+	}
+}
+
+
+
+#endif // ifndef TYPES_VECTOR3_ARRAY_H
@@ -0,0 +1,119 @@
+/** \file allocations.cpp
+    \brief Юнит-тесты, проверяющие, что число выделений памяти при работе алгоритмов не зависит от длины расчёта.
+
+	Глобальные operator new/delete здесь заменяются на считающие число
+	выделений памяти (замена действует на всю программу с unit-тестами).
+*/
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+#include <new>
+#include "../../algorithms/old_algorithms/panov_algorithm.hpp"
+#include "../../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+
+
+#if __cplusplus < 201103L
+#define ALLOCATIONS_THROW_BAD_ALLOC throw (std::bad_alloc)
+#define ALLOCATIONS_NOTHROW throw ()
+#else
+#define ALLOCATIONS_THROW_BAD_ALLOC
+#define ALLOCATIONS_NOTHROW noexcept
+#endif
+
+
+//! Число выделений памяти с начала работы программы.
+static size_t allocations_count = 0;
+
+
+void * operator new (std::size_t size) ALLOCATIONS_THROW_BAD_ALLOC {
+	++allocations_count;
+	void * p = std::malloc (size ? size : 1);
+	if (! p)
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete (void * p) ALLOCATIONS_NOTHROW {
+	std::free (p);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete (void * p, std::size_t) ALLOCATIONS_NOTHROW {
+	std::free (p);
+}
+#endif
+
+
+
+namespace {
+
+
+//! Возвращает число выделений памяти при запуске алгоритма на отрезке [0; last_time].
+size_t count_execute_allocations (algorithm<quaternion,vector3> & alg, long double last_time) {
+	alg.set_last_time (last_time);
+	size_t before = allocations_count;
+	alg.execute();
+	return allocations_count - before;
+}
+
+
+} // namespace
+
+
+
+BOOST_AUTO_TEST_SUITE( allocations_test )
+
+
+BOOST_AUTO_TEST_CASE( execute_test )
+{
+	panov_algorithm dynamic;
+	static_panov_algorithm fixed;
+	// источник с интегратором по умолчанию (методом Симпсона)
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (0.1, 0.2, 0.3),
+		plane_angles (1, 2, 3)
+	);
+	boost::shared_ptr < input_data<quaternion,vector3> > data = input.get_input_data();
+	algorithm<quaternion,vector3> * algs[] = { &dynamic, &fixed };
+
+	// 1000 и 5000 шагов: во втором случае входные данные запрашиваются несколькими блоками;
+	// первый запуск заполняет рабочие массивы источника
+	for (int j=0; j<2; ++j) {
+		algs[j]->set_input_data (data);
+		algs[j]->set_step (0.001);
+		count_execute_allocations (*algs[j], 5);
+		BOOST_CHECK_EQUAL( count_execute_allocations (*algs[j], 1), count_execute_allocations (*algs[j], 5) );
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( exact_solution_test )
+{
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (0.1, 0.2, 0.3),
+		plane_angles (1, 2, 3)
+	);
+
+	size_t before = allocations_count;
+	input.get_exact_solution (0.01, 10);
+	size_t short_run = allocations_count - before;
+
+	before = allocations_count;
+	input.get_exact_solution (0.01, 1000);
+	BOOST_CHECK_EQUAL( allocations_count - before, short_run );
+}
+
+
+BOOST_AUTO_TEST_CASE( stream_test )
+{
+	panov_algorithm alg;
+	alg.set_step (0.01);
+	alg.start_stream (quaternion (1));
+
+	size_t before = allocations_count;
+	for (int i=0; i<4000; ++i)
+		alg.push_increment (vector3 (0.001, 0.002, 0.003));
+	BOOST_CHECK_EQUAL( allocations_count - before, 0u );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,215 @@
+/** \file iterative_algorithm.cpp
+    \brief Юнит-тесты для файла "algorithms/iterative_algorithm.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "../../algorithms/old_algorithms/average_speed_algorithm.hpp"
+#include "../../algorithms/old_algorithms/method_2step_4degree.hpp"
+#include "../../algorithms/old_algorithms/panov_algorithm.hpp"
+#include "../../algorithms/old_algorithms/panov_riccati_algorithm.hpp"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+//! Источник входных данных с заранее заданными приращениями.
+class test_input_data : public input_data<quaternion,vector3> {
+
+public:
+
+	virtual quaternion get_initial_solution() {
+		return quaternion (1);
+	}
+
+	virtual vector3 get_integrated (long double t1, long double t2) {
+		return vector3 (sin (t1), cos (3 * t1), 0.5) * (t2 - t1);
+	}
+
+}; // class test_input_data
+
+
+/** Двухшаговый алгоритм, который на каждом шаге сверяет историю входных данных с самими данными.
+ *
+ * В историю складываются подотрезки длины step/2, поэтому
+ * get_integrated_data(idx) должен возвращать данные на подотрезке idx - и
+ * из истории, и (для вытесненных отрезков) от источника.
+ */
+class history_probe_algorithm : public iterative_algorithm<quaternion,vector3> {
+
+public:
+
+	history_probe_algorithm()
+		: max_difference (0)
+	{ }
+
+	//! Наибольшее расхождение get_integrated_data() с ожидаемыми значениями.
+	long double max_difference;
+
+	virtual std::string get_algorithm_title() {
+		return "history probe";
+	}
+
+protected:
+
+	virtual int get_algorithm_steps_count_() {
+		return 2;
+	}
+
+	virtual size_t get_history_capacity_() {
+		return 2;
+	}
+
+	virtual quaternion get_local_solution_ (long double t, const std::vector<vector3> & gamma) {
+		size_t last = history_.get_next_index() - 1;
+		long double half = step_ / 2;
+		check_ (get_integrated_data (last), gamma[1]);
+		check_ (get_integrated_data (last - 1), gamma[0]);
+		if (last > 2)
+			check_ (get_integrated_data (last - 2), input_data_->get_integrated (t - 3 * half, t - 2 * half));
+		return quaternion (1);
+	}
+
+private:
+
+	void check_ (const vector3 & value, const vector3 & expected) {
+		max_difference = std::max (max_difference, distance (value, expected));
+	}
+
+}; // class history_probe_algorithm
+
+
+BOOST_AUTO_TEST_SUITE( iterative_algorithm_test )
+
+
+//! Проверяет, что виртуальный и статический (см. static_iterative_algorithm) варианты алгоритма дают побитово одинаковые решения.
+static void check_static (algorithm<quaternion,vector3> & virtual_alg, algorithm<quaternion,vector3> & static_alg) {
+	boost::shared_ptr < input_data<quaternion,vector3> > data (new test_input_data);
+	algorithm<quaternion,vector3> * algs[] = { &virtual_alg, &static_alg };
+	for (int k=0; k<2; ++k) {
+		algs[k]->set_input_data (data);
+		algs[k]->set_step (0.01);
+		algs[k]->set_last_time (10);
+	}
+
+	BOOST_AUTO( virtual_output, virtual_alg.execute() );
+	BOOST_AUTO( static_output, static_alg.execute() );
+	BOOST_REQUIRE_EQUAL( virtual_output->get_count(), static_output->get_count() );
+	for (size_t i=0; i<virtual_output->get_count(); ++i) {
+		BOOST_CHECK_EQUAL( virtual_output->ts[i], static_output->ts[i] );
+		BOOST_CHECK_EQUAL( (*virtual_output)[i], (*static_output)[i] );
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( parallel_test )
+{
+	panov_algorithm serial, parallel;
+	parallel.set_parallel (true);
+
+	boost::shared_ptr < input_data<quaternion,vector3> > data (new test_input_data);
+	algorithm<quaternion,vector3> * algs[] = { &serial, &parallel };
+	for (int j=0; j<2; ++j) {
+		algs[j]->set_input_data (data);
+		algs[j]->set_step (0.01);
+		algs[j]->set_last_time (1000);
+	}
+
+	// несколько потоков - иначе кусок один, и ответы на границах кусков не вычисляются
+#ifdef _OPENMP
+	int threads = omp_get_max_threads();
+	omp_set_num_threads (4);
+#endif
+	BOOST_AUTO( serial_output, algs[0]->execute() );
+	BOOST_AUTO( parallel_output, algs[1]->execute() );
+#ifdef _OPENMP
+	omp_set_num_threads (threads);
+#endif
+
+	// последовательный и параллельный режимы отличаются только нормированием на границах кусков
+	BOOST_REQUIRE_EQUAL( serial_output->get_count(), parallel_output->get_count() );
+	for (size_t i=0; i<serial_output->get_count(); ++i)
+		BOOST_CHECK_SMALL( distance ((*serial_output)[i], (*parallel_output)[i]), 1E-15L );
+}
+
+
+BOOST_AUTO_TEST_CASE( static_test )
+{
+	{
+		average_speed_algorithm<quaternion,vector3> a;
+		static_average_speed_algorithm<quaternion,vector3> b;
+		check_static (a, b);
+	}
+	{
+		method_2step_4degree a;
+		static_method_2step_4degree b;
+		check_static (a, b);
+	}
+	{
+		panov_algorithm a;
+		static_panov_algorithm b;
+		check_static (a, b);
+	}
+	{
+		panov_riccati_algorithm a;
+		static_panov_riccati_algorithm b;
+		check_static (a, b);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( stream_test )
+{
+	panov_algorithm batch, stream;
+	boost::shared_ptr < input_data<quaternion,vector3> > data (new test_input_data);
+	algorithm<quaternion,vector3> & batch_alg = batch;
+	batch_alg.set_input_data (data);
+	batch_alg.set_step (0.01);
+	batch_alg.set_last_time (10);
+	BOOST_AUTO( output, batch_alg.execute() );
+
+	BOOST_CHECK_THROW( stream.push_increment (vector3()), std::logic_error );
+
+	// входные данные передаются по одному подотрезку, ответ обновляется каждые четыре подотрезка
+	stream.set_step (0.01);
+	stream.start_stream (quaternion (1));
+	for (size_t i=1; i<output->get_count(); ++i) {
+		for (int j=0; j<4; ++j) {
+			long double t1 = output->ts[i-1] + 0.0025L * j;
+			BOOST_CHECK_EQUAL( stream.push_increment (data->get_integrated (t1, t1 + 0.0025L)), j == 3 );
+		}
+		BOOST_CHECK_EQUAL( stream.get_stream_steps_count(), i );
+		BOOST_CHECK_SMALL( distance (stream.get_orientation(), (*output)[i]), 1E-15L );
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( history_interval_test )
+{
+	history_probe_algorithm probe;
+	algorithm<quaternion,vector3> & alg = probe;
+	alg.set_input_data (boost::shared_ptr < input_data<quaternion,vector3> > (new test_input_data));
+	alg.set_step (0.01);
+	alg.set_last_time (1);
+	alg.execute();
+	BOOST_CHECK_SMALL( probe.max_difference, 1E-18L );
+}
+
+
+BOOST_AUTO_TEST_CASE( parallel_history_test )
+{
+	// алгоритмам с историей входных данных параллельный режим недоступен
+	history_probe_algorithm probe;
+	BOOST_CHECK_THROW( probe.set_parallel (true), std::logic_error );
+	BOOST_CHECK( !probe.get_parallel() );
+	probe.set_parallel (false);
+
+	panov_algorithm panov;
+	panov.set_parallel (true);
+	BOOST_CHECK( panov.get_parallel() );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
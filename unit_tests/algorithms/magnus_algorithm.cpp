@@ -0,0 +1,102 @@
+/** \file magnus_algorithm.cpp
+    \brief Юнит-тесты для файла "algorithms/magnus_algorithm.hpp": точность относительно точного решения.
+*/
+#include <boost/test/unit_test.hpp>
+#include <boost/typeof/typeof.hpp>
+#include <algorithm>
+#include "../../algorithms/magnus_algorithm.hpp"
+#include "../../algorithms/old_algorithms/panov_algorithm.hpp"
+#include "../../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+
+
+//! Время моделирования (в секундах).
+static const long double last_time = 10;
+
+
+//! Возвращает наибольшую погрешность алгоритма с шагом h относительно точного решения источника.
+static long double max_error (algorithm<quaternion,vector3> & alg, long double h) {
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (0.3, 0.2, 0.3),
+		plane_angles (1, 2, 3)
+	);
+	input.set_analytic_increments (true);
+
+	alg.set_input_data (input.get_input_data());
+	alg.set_step (h);
+	alg.set_last_time (last_time);
+	BOOST_AUTO( output, alg.execute() );
+	BOOST_AUTO( exact, input.get_exact_solution (h, last_time) );
+
+	long double result = 0;
+	for (size_t i=0; i<output->get_count(); ++i)
+		result = std::max (result, distance ((*output)[i], (*exact)[i]));
+	return result;
+}
+
+
+BOOST_AUTO_TEST_SUITE( magnus_algorithm_test )
+
+
+BOOST_AUTO_TEST_CASE( panov_accuracy_test )
+{
+	// четырёхшаговый алгоритм не хуже алгоритма Панова (тоже четырёхшагового)
+	magnus_algorithm<4> magnus;
+	panov_algorithm panov;
+	BOOST_CHECK_LE( max_error (magnus, 0.05), max_error (panov, 0.05) );
+}
+
+
+BOOST_AUTO_TEST_CASE( convergence_order_test )
+{
+	// при уменьшении шага вдвое погрешность двухшагового алгоритма падает примерно в 2^4 раз,
+	// а четырёхшагового (члены до четвёртого порядка включительно) - примерно в 2^6 раз
+	magnus_algorithm<2> magnus2;
+	magnus_algorithm<4> magnus4;
+	long double ratio2 = max_error (magnus2, 0.1) / max_error (magnus2, 0.05);
+	long double ratio4 = max_error (magnus4, 0.1) / max_error (magnus4, 0.05);
+	BOOST_CHECK_GT( ratio2, 12 );
+	BOOST_CHECK_LT( ratio2, 20 );
+	BOOST_CHECK_GT( ratio4, 48 );
+}
+
+
+//! Расхождение ряда последовательных приближений до четвёртого порядка с тензорами коэффициентов на шаге h гладкой скорости.
+template <int N>
+static long double series_tensor_difference (long double h) {
+	boost::array<vector3, N> gamma;
+	for (int i=0; i<N; ++i) {
+		long double t = h * (i + 0.5L) / N;
+		gamma[i] = vector3 (1 + 2 * t, std::sin (3 * t), std::cos (2 * t)) * (h / N);
+	}
+	return distance (magnus_series_rotation_vector<N, 4> (gamma), magnus_tensor_rotation_vector<N> (gamma));
+}
+
+
+BOOST_AUTO_TEST_CASE( series_tensor_test )
+{
+	// способы расходятся только в членах пятого порядка и выше
+	BOOST_CHECK_SMALL( series_tensor_difference<1> (0.1), 1E-18L );
+	BOOST_CHECK_GT( series_tensor_difference<2> (0.1) / series_tensor_difference<2> (0.05), 24 );
+	BOOST_CHECK_GT( series_tensor_difference<3> (0.1) / series_tensor_difference<3> (0.05), 24 );
+	BOOST_CHECK_GT( series_tensor_difference<4> (0.1) / series_tensor_difference<4> (0.05), 24 );
+	BOOST_CHECK_GT( series_tensor_difference<5> (0.1) / series_tensor_difference<5> (0.05), 24 );
+	BOOST_CHECK_GT( series_tensor_difference<6> (0.1) / series_tensor_difference<6> (0.05), 24 );
+}
+
+
+BOOST_AUTO_TEST_CASE( high_order_test )
+{
+	// пяти- и шестишаговые алгоритмы точнее четырёхшагового
+	magnus_algorithm<4> magnus4;
+	magnus_algorithm<5> magnus5;
+	magnus_algorithm<6> magnus6;
+	long double error4 = max_error (magnus4, 0.1);
+	long double error5 = max_error (magnus5, 0.1);
+	long double error6 = max_error (magnus6, 0.1);
+	BOOST_CHECK_LT( error5, error4 );
+	BOOST_CHECK_LT( error6, error5 );
+	BOOST_CHECK_GT( max_error (magnus6, 0.2) / error6, 48 );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
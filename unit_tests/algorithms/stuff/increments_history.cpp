@@ -0,0 +1,58 @@
+/** \file increments_history.cpp
+    \brief Юнит-тесты для файла "algorithms/stuff/increments_history.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <stdexcept>
+#include "../../../algorithms/stuff/increments_history.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( increments_history_test )
+
+
+BOOST_AUTO_TEST_CASE( push_test )
+{
+	increments_history<int> history (3);
+	BOOST_CHECK_EQUAL( history.get_count(), 0u );
+	BOOST_CHECK_EQUAL( history.get_next_index(), 1u );
+	BOOST_CHECK( ! history.contains (1) );
+
+	for (int i=1; i<=5; ++i)
+		history.push (10 * i);
+
+	// хранятся только три последних отрезка
+	BOOST_CHECK_EQUAL( history.get_count(), 3u );
+	BOOST_CHECK_EQUAL( history.get_next_index(), 6u );
+	BOOST_CHECK( ! history.contains (2) );
+	BOOST_CHECK( ! history.contains (6) );
+	BOOST_CHECK_EQUAL( history[3], 30 );
+	BOOST_CHECK_EQUAL( history[4], 40 );
+	BOOST_CHECK_EQUAL( history[5], 50 );
+	BOOST_CHECK_THROW( history[2], std::out_of_range );
+}
+
+
+BOOST_AUTO_TEST_CASE( zero_capacity_test )
+{
+	increments_history<int> history;
+	history.push (1);
+	history.push (2);
+
+	BOOST_CHECK_EQUAL( history.get_count(), 0u );
+	BOOST_CHECK_EQUAL( history.get_next_index(), 3u );
+	BOOST_CHECK( ! history.contains (2) );
+}
+
+
+BOOST_AUTO_TEST_CASE( reset_test )
+{
+	increments_history<int> history (2);
+	history.push (1);
+	history.reset (4);
+
+	BOOST_CHECK_EQUAL( history.get_capacity(), 4u );
+	BOOST_CHECK_EQUAL( history.get_count(), 0u );
+	BOOST_CHECK_EQUAL( history.get_next_index(), 1u );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+/** \file magnus_coefficients.cpp
+    \brief Юнит-тесты для файла "algorithms/stuff/magnus_coefficients.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include "../../../algorithms/stuff/magnus_coefficients.hpp"
+
+
+static const double tolerance = 1E-12;
+
+
+BOOST_AUTO_TEST_SUITE( magnus_coefficients_test )
+
+
+BOOST_AUTO_TEST_CASE( pair_index_test )
+{
+	BOOST_CHECK_EQUAL( magnus_coefficients<4>::pairs_count, 6 );
+	BOOST_CHECK_EQUAL( magnus_coefficients<4>::pair_index (0, 1), 0 );
+	BOOST_CHECK_EQUAL( magnus_coefficients<4>::pair_index (0, 3), 2 );
+	BOOST_CHECK_EQUAL( magnus_coefficients<4>::pair_index (1, 2), 3 );
+	BOOST_CHECK_EQUAL( magnus_coefficients<4>::pair_index (2, 3), 5 );
+}
+
+
+BOOST_AUTO_TEST_CASE( classic_coning_coefficients_test )
+{
+	// двух-, трёх- и четырёхшаговые коэффициенты второго порядка известны из литературы
+	const magnus_coefficients<2> & c2 = magnus_coefficients<2>::get();
+	BOOST_CHECK_CLOSE( (double) c2.second[0], 2.0 / 3, tolerance );
+
+	const magnus_coefficients<3> & c3 = magnus_coefficients<3>::get();
+	BOOST_CHECK_CLOSE( (double) c3.second[magnus_coefficients<3>::pair_index (0, 1)], 57.0 / 80, tolerance );
+	BOOST_CHECK_CLOSE( (double) c3.second[magnus_coefficients<3>::pair_index (0, 2)], 33.0 / 80, tolerance );
+	BOOST_CHECK_CLOSE( (double) c3.second[magnus_coefficients<3>::pair_index (1, 2)], 57.0 / 80, tolerance );
+
+	const magnus_coefficients<4> & c4 = magnus_coefficients<4>::get();
+	BOOST_CHECK_CLOSE( (double) c4.second[magnus_coefficients<4>::pair_index (0, 1)], 736.0 / 945, tolerance );
+	BOOST_CHECK_CLOSE( (double) c4.second[magnus_coefficients<4>::pair_index (0, 2)], 334.0 / 945, tolerance );
+	BOOST_CHECK_CLOSE( (double) c4.second[magnus_coefficients<4>::pair_index (0, 3)], 526.0 / 945, tolerance );
+	BOOST_CHECK_CLOSE( (double) c4.second[magnus_coefficients<4>::pair_index (1, 2)], 654.0 / 945, tolerance );
+	BOOST_CHECK_CLOSE( (double) c4.second[magnus_coefficients<4>::pair_index (1, 3)], 334.0 / 945, tolerance );
+	BOOST_CHECK_CLOSE( (double) c4.second[magnus_coefficients<4>::pair_index (2, 3)], 736.0 / 945, tolerance );
+}
+
+
+BOOST_AUTO_TEST_CASE( single_step_test )
+{
+	// на одном подотрезке вектор поворота - это сами входные данные
+	const magnus_coefficients<1> & c1 = magnus_coefficients<1>::get();
+	BOOST_CHECK( c1.second.empty() );
+	BOOST_CHECK( c1.third.empty() );
+	BOOST_CHECK( c1.fourth_a.empty() );
+	BOOST_CHECK( c1.fourth_b.empty() );
+}
+
+
+//! Проверяет, что интеграл многочлена скорости по i-му подотрезку [-1; 1] равен gamma[i].
+template <int N>
+static void check_velocity () {
+	const magnus_coefficients<N> & c = magnus_coefficients<N>::get();
+	BOOST_REQUIRE_EQUAL( c.velocity.size(), (size_t) (N * N) );
+	for (int i=0; i<N; ++i)
+		for (int j=0; j<N; ++j) {
+			long double a = -1 + 2.0L * j / N, b = -1 + 2.0L * (j + 1) / N;
+			long double a_power = a, b_power = b, integral = 0;
+			for (int m=0; m<N; ++m) {
+				integral += c.velocity[m * N + i] * (b_power - a_power) / (m + 1);
+				a_power *= a;
+				b_power *= b;
+			}
+			BOOST_CHECK_SMALL( (double) (integral - (i == j)), tolerance );
+		}
+}
+
+
+BOOST_AUTO_TEST_CASE( velocity_test )
+{
+	check_velocity<1>();
+	check_velocity<2>();
+	check_velocity<4>();
+	check_velocity<6>();
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
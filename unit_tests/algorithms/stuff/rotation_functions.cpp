@@ -0,0 +1,104 @@
+/** \file rotation_functions.cpp
+    \brief Юнит-тесты для файла "algorithms/stuff/rotation_functions.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <limits>
+#include "../../../algorithms/stuff/rotation_functions.hpp"
+#include "../../../types/biquaternion.hpp"
+#include "../../../types/dual_vector.hpp"
+#include "../../../types/quaternion.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( rotation_functions_test )
+
+
+//! Длины векторов поворота, на которых проверяются функции: и по ряду, и через sin/cos/tan.
+static const long double angles[] = { 1E-12L, 1E-6L, 1E-3L, 0.01L, 0.1L, 0.3L, 0.49L, 0.5L, 0.51L, 1, 2 };
+
+
+/** Проверяет функции rotation_functions<T> относительно std::sin, std::cos и std::tan от long double.
+ *
+ * @param ulps Допустимая относительная ошибка в единицах эпсилон типа T.
+ */
+template <typename T>
+void check_accuracy (long double ulps) {
+	long double tolerance = ulps * std::numeric_limits<T>::epsilon();
+	for (size_t i=0; i<sizeof (angles) / sizeof (angles[0]); ++i) {
+		T phi_m = T (angles[i]);
+		long double x = phi_m;
+		BOOST_CHECK_SMALL( half_angle_cos (phi_m) / std::cos (x / 2) - 1, tolerance );
+		BOOST_CHECK_SMALL( half_angle_sinc (phi_m) / (std::sin (x / 2) / x) - 1, tolerance );
+		BOOST_CHECK_SMALL( quarter_angle_tanc (phi_m) / (std::tan (x / 4) / x) - 1, tolerance );
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( accuracy_test )
+{
+	check_accuracy<float> (2);
+	check_accuracy<double> (2);
+	check_accuracy<long double> (4);
+}
+
+
+BOOST_AUTO_TEST_CASE( zero_angle_test )
+{
+	BOOST_CHECK_EQUAL( half_angle_cos (0.0L), 1 );
+	BOOST_CHECK_EQUAL( half_angle_sinc (0.0L), 0.5L );
+	BOOST_CHECK_EQUAL( quarter_angle_tanc (0.0L), 0.25L );
+
+	// поворот на нулевой вектор - единичный кватернион (без деления на ноль)
+	BOOST_CHECK_EQUAL( rotation_quaternion<quaternion> (vector3()), quaternion (1) );
+	BOOST_CHECK_EQUAL( rotation_riccati_solution<quaternion> (vector3()), quaternion() );
+}
+
+
+BOOST_AUTO_TEST_CASE( rotation_quaternion_test )
+{
+	vector3 phi (0.03, -0.04, 0.12);
+	long double phi_m = phi.length();
+	quaternion expected (std::cos (phi_m / 2), phi * (std::sin (phi_m / 2) / phi_m));
+
+	BOOST_CHECK_SMALL( distance (rotation_quaternion<quaternion> (phi), expected), 1E-18L );
+	BOOST_CHECK_SMALL( distance (rotation_riccati_solution<quaternion> (phi), quaternion (phi * (std::tan (phi_m / 4) / phi_m))), 1E-18L );
+}
+
+
+BOOST_AUTO_TEST_CASE( generic_zero_angle_test )
+{
+	// общий шаблон (здесь - для дуальных чисел) тоже не делит на ноль
+	BOOST_CHECK_EQUAL( half_angle_sinc (dual_number()).real, 0.5L );
+	BOOST_CHECK_EQUAL( half_angle_sinc (dual_number()).imag, 0 );
+	BOOST_CHECK_EQUAL( quarter_angle_tanc (dual_number()).real, 0.25L );
+	BOOST_CHECK_EQUAL( quarter_angle_tanc (dual_number()).imag, 0 );
+
+	biquaternion q = rotation_quaternion<biquaternion> (dual_vector());
+	BOOST_CHECK_EQUAL( q.a, quaternion (1) );
+	BOOST_CHECK_EQUAL( q.b, quaternion() );
+
+	// поворот на чисто дуальный вектор: (1, s phi/2) с точностью до s^2
+	vector3 phi (0.03, -0.04, 0.12);
+	q = rotation_quaternion<biquaternion> (dual_vector (vector3(), phi));
+	BOOST_CHECK_EQUAL( q.a, quaternion (1) );
+	BOOST_CHECK_EQUAL( q.b, quaternion (0, phi / 2) );
+}
+
+
+BOOST_AUTO_TEST_CASE( generic_accuracy_test )
+{
+	// значения - как у специализации для long double, производные - как у формул
+	for (size_t i=0; i<sizeof (angles) / sizeof (angles[0]); ++i) {
+		long double x = angles[i];
+		if (x < 1E-3L)
+			continue;
+		dual_number sinc = half_angle_sinc (dual_number (x, 1)), tanc = quarter_angle_tanc (dual_number (x, 1));
+		BOOST_CHECK_CLOSE( sinc.real, half_angle_sinc (x), 1E-12L );
+		BOOST_CHECK_CLOSE( tanc.real, quarter_angle_tanc (x), 1E-12L );
+		BOOST_CHECK_CLOSE( sinc.imag, (x / 2 * std::cos (x / 2) - std::sin (x / 2)) / (x * x), 1E-8L );
+		BOOST_CHECK_CLOSE( tanc.imag, (x / 4 / (std::cos (x / 4) * std::cos (x / 4)) - std::tan (x / 4)) / (x * x), 1E-8L );
+	}
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,70 @@
+/** \file solution_accumulator.cpp
+    \brief Юнит-тесты для файла "algorithms/stuff/solution_accumulator.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include "../../../algorithms/stuff/solution_accumulator.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( solution_accumulator_test )
+
+
+//! Поворот на небольшой угол, заданный в double.
+static basic_quaternion<double> small_rotation() {
+	double half_angle = 1E-3;
+	return basic_quaternion<double> (std::cos (half_angle), basic_vector3<double> (0.6, 0, 0.8) * std::sin (half_angle));
+}
+
+
+BOOST_AUTO_TEST_CASE( native_test )
+{
+	basic_quaternion<double> q = small_rotation(), expected (1);
+	solution_accumulator< basic_quaternion<double> > accumulator (native_accumulation, expected);
+
+	for (int i=0; i<100; ++i) {
+		expected = expected * q;
+		BOOST_CHECK_EQUAL( accumulator.multiply (q), expected );
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( extended_precision_test )
+{
+	const int steps = 100000;
+	basic_quaternion<double> q = small_rotation();
+	quaternion reference (1);
+
+	solution_accumulator< basic_quaternion<double> >
+		native (native_accumulation, basic_quaternion<double> (1)),
+		extended (long_double_accumulation, basic_quaternion<double> (1)),
+		double_double (double_double_accumulation, basic_quaternion<double> (1));
+
+	basic_quaternion<double> native_result, extended_result, double_double_result;
+	for (int i=0; i<steps; ++i) {
+		reference = reference * quaternion (q);
+		native_result = native.multiply (q);
+		extended_result = extended.multiply (q);
+		double_double_result = double_double.multiply (q);
+	}
+
+	// при повышенной точности накопления остаётся лишь погрешность округления ответа до double
+	BOOST_CHECK_SMALL( distance (quaternion (extended_result), reference), 1E-15L );
+	BOOST_CHECK_SMALL( distance (quaternion (double_double_result), reference), 1E-15L );
+	BOOST_CHECK( distance (quaternion (native_result), reference) > distance (quaternion (double_double_result), reference) );
+}
+
+
+BOOST_AUTO_TEST_CASE( double_double_long_double_test )
+{
+	// для long double двойная-двойная точность не действует: ответ тот же, что и при native_accumulation
+	quaternion q (small_rotation()), expected (1);
+	solution_accumulator<quaternion> accumulator (double_double_accumulation, expected);
+
+	for (int i=0; i<100; ++i) {
+		expected *= q;
+		BOOST_CHECK_EQUAL( accumulator.multiply (q), expected );
+	}
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
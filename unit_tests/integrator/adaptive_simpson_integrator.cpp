@@ -0,0 +1,86 @@
+/** \file adaptive_simpson_integrator.cpp
+    \brief Юнит-тесты для файла "integrator/adaptive_simpson_integrator.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <stdexcept>
+#include "../../integrator/adaptive_simpson_integrator.hpp"
+#include "../../types/vector3.hpp"
+
+
+static long double cubic (long double x) {
+	return x * x * x - 2 * x + 1;
+}
+
+static long double sinus (long double x) {
+	return sin (x);
+}
+
+static vector3 curve (long double x) {
+	return vector3 (cos (x), sin (x), 2 * x);
+}
+
+
+BOOST_AUTO_TEST_SUITE( adaptive_simpson_integrator_test )
+
+
+BOOST_AUTO_TEST_CASE( cubic_test )
+{
+	adaptive_simpson_integrator<long double> integr (1E-12);
+
+	// формула Симпсона точна для многочленов третьей степени, поэтому дальше
+	// обязательного первого деления (и проверки обеих половин) дело не идёт
+	BOOST_CHECK_SMALL( integr.integrate (cubic, 0, 2) - 2.0L, 1E-15L );
+	BOOST_CHECK_EQUAL( integr.get_evaluations_count(), 9 );
+}
+
+
+BOOST_AUTO_TEST_CASE( tolerance_test )
+{
+	adaptive_simpson_integrator<long double> coarse (1E-4), fine (1E-12);
+
+	long double coarse_result = coarse.integrate (sinus, 0, 3.14159265358979323846L);
+	long double fine_result = fine.integrate (sinus, 0, 3.14159265358979323846L);
+
+	BOOST_CHECK_SMALL( coarse_result - 2.0L, 1E-4L );
+	BOOST_CHECK_SMALL( fine_result - 2.0L, 1E-12L );
+	BOOST_CHECK( coarse.get_evaluations_count() < fine.get_evaluations_count() );
+	// каждое деление добавляет ровно два новых вычисления функции
+	BOOST_CHECK_EQUAL( fine.get_evaluations_count() % 2, 1 );
+}
+
+
+BOOST_AUTO_TEST_CASE( relative_tolerance_test )
+{
+	adaptive_simpson_integrator<vector3> integr (0, 1E-12);
+
+	vector3 result = integr.integrate (curve, 0, 1);
+
+	BOOST_CHECK_SMALL( distance (result, vector3 (sin (1.0L), 1 - cos (1.0L), 1)), 1E-11L );
+}
+
+
+
+BOOST_AUTO_TEST_CASE( invalid_tolerance_test )
+{
+	typedef adaptive_simpson_integrator<long double> t_integrator;
+
+	BOOST_CHECK_THROW( t_integrator (0), std::invalid_argument );
+	BOOST_CHECK_THROW( t_integrator (0, 0), std::invalid_argument );
+	BOOST_CHECK_THROW( t_integrator (-1E-12), std::invalid_argument );
+	BOOST_CHECK_THROW( t_integrator (1E-12, -1), std::invalid_argument );
+	BOOST_CHECK_THROW( t_integrator (1E-12, 0, 0), std::invalid_argument );
+}
+
+
+BOOST_AUTO_TEST_CASE( zero_integral_test )
+{
+	// интеграл равен нулю, так что относительный допуск тоже почти нулевой;
+	// деление останавливается на уровне ошибок округления, а не на max_depth
+	adaptive_simpson_integrator<long double> integr (0, 1E-12);
+
+	BOOST_CHECK_SMALL( integr.integrate (sinus, 0, 2 * 3.14159265358979323846L), 1E-15L );
+	BOOST_CHECK( integr.get_evaluations_count() < 1000000 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,64 @@
+/** \file gauss_legendre_integrator.cpp
+    \brief Юнит-тесты для файла "integrator/gauss_legendre_integrator.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include "../../integrator/gauss_legendre_integrator.hpp"
+
+
+//! Многочлен x^degree.
+struct power {
+	int degree;
+	long double operator() (long double x) const {
+		return pow (x, degree);
+	}
+};
+
+//! Проверяет, что формула с N узлами точна для многочленов степени до 2N-1.
+template <int N>
+void check_exactness() {
+	gauss_legendre_integrator<long double, N> integr;
+
+	long double weights_sum = 0;
+	for (int j=0; j<N; ++j)
+		weights_sum += gauss_legendre_table<N>::weights()[j];
+	BOOST_CHECK_SMALL( weights_sum - 2.0L, 1E-18L );
+
+	for (int degree=0; degree<2*N; ++degree) {
+		power f = { degree };
+		long double exact = (pow (2.0L, degree + 1) - pow (-1.0L, degree + 1)) / (degree + 1);
+		BOOST_CHECK_SMALL( integr.integrate (f, -1, 2) - exact, 1E-15L * pow (2.0L, degree + 1) );
+	}
+}
+
+
+BOOST_AUTO_TEST_SUITE( gauss_legendre_integrator_test )
+
+
+BOOST_AUTO_TEST_CASE( exactness_test )
+{
+	check_exactness<1>();
+	check_exactness<2>();
+	check_exactness<3>();
+	check_exactness<4>();
+	check_exactness<5>();
+	check_exactness<6>();
+	check_exactness<7>();
+	check_exactness<8>();
+	check_exactness<9>();
+	check_exactness<10>();
+}
+
+
+BOOST_AUTO_TEST_CASE( pieces_test )
+{
+	gauss_legendre_integrator<long double, 5> whole, pieces (0.1);
+	power f = { 12 };
+
+	long double exact = 2.0L / 13;
+	BOOST_CHECK( fabs (pieces.integrate (f, -1, 1) - exact) < fabs (whole.integrate (f, -1, 1) - exact) );
+	BOOST_CHECK_SMALL( pieces.integrate (f, -1, 1) - exact, 1E-12L );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
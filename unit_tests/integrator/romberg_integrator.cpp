@@ -0,0 +1,46 @@
+/** \file romberg_integrator.cpp
+    \brief Юнит-тесты для файла "integrator/romberg_integrator.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include "../../integrator/romberg_integrator.hpp"
+
+
+static long double cubic (long double x) {
+	return x * x * x - 2 * x + 1;
+}
+
+static long double exponent (long double x) {
+	return exp (x);
+}
+
+
+BOOST_AUTO_TEST_SUITE( romberg_integrator_test )
+
+
+BOOST_AUTO_TEST_CASE( cubic_test )
+{
+	romberg_integrator<long double> integr (1E-15);
+
+	// уже первая экстраполяция (формула Симпсона) точна для кубических многочленов
+	BOOST_CHECK_SMALL( integr.integrate (cubic, 0, 2) - 2.0L, 1E-15L );
+	BOOST_CHECK_EQUAL( integr.get_levels_count(), 2 );
+	BOOST_CHECK_EQUAL( integr.get_evaluations_count(), 5 );
+}
+
+
+BOOST_AUTO_TEST_CASE( tolerance_test )
+{
+	romberg_integrator<long double> coarse (1E-6), fine (1E-14);
+
+	long double exact = exp (1.0L) - 1;
+	BOOST_CHECK_SMALL( coarse.integrate (exponent, 0, 1) - exact, 1E-6L );
+	BOOST_CHECK_SMALL( fine.integrate (exponent, 0, 1) - exact, 1E-14L );
+
+	BOOST_CHECK( coarse.get_levels_count() < fine.get_levels_count() );
+	// на каждом уровне вычисляются только середины прежних отрезков
+	BOOST_CHECK_EQUAL( fine.get_evaluations_count(), (1 << fine.get_levels_count()) + 1 );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,126 @@
+/** \file simpson_integrator.cpp
+    \brief Юнит-тесты для файла "integrator/simpson_integrator.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <vector>
+#include "../../integrator/integrator.hpp"
+
+
+//! Функция, подсчитывающая число своих вычислений.
+struct counting_sinus {
+	int * count;
+	long double operator() (long double x) const {
+		++ *count;
+		return sin (x);
+	}
+};
+
+
+//! Пакетная функция, подсчитывающая число своих вызовов.
+struct counting_batch_sinus {
+	int * calls;
+	void operator() (const long double * xs, size_t count, long double * values) const {
+		++ *calls;
+		for (size_t i=0; i<count; ++i)
+			values[i] = sin (xs[i]);
+	}
+};
+
+
+BOOST_AUTO_TEST_SUITE( simpson_integrator_test )
+
+
+BOOST_AUTO_TEST_CASE( integrate_test )
+{
+	simpson_integrator<long double> integr (1E-3);
+	int count = 0;
+	counting_sinus f = { &count };
+
+	BOOST_CHECK_SMALL( integr.integrate (f, 0, 3.14159265358979323846L) - 2.0L, 1E-12L );
+	BOOST_CHECK_EQUAL( count, 3142 + 1 );
+}
+
+
+BOOST_AUTO_TEST_CASE( integrate_range_test )
+{
+	simpson_integrator<long double> integr (0.01);
+	int count = 0;
+	counting_sinus f = { &count };
+
+	std::vector<long double> result;
+	integr.integrate_range (f, 0.5, 0.1, 20, result);
+
+	// концы соседних отрезков общие: 20 отрезков по 10 частей - это 201 вычисление, а не 220
+	BOOST_CHECK_EQUAL( result.size(), 20u );
+	BOOST_CHECK_EQUAL( count, 201 );
+
+	for (size_t k=0; k<result.size(); ++k)
+		BOOST_CHECK_SMALL( result[k] - integr.integrate (f, 0.5 + 0.1 * k, 0.5 + 0.1 * (k + 1)), 1E-15L );
+}
+
+
+BOOST_AUTO_TEST_CASE( integrate_batch_test )
+{
+	simpson_integrator<long double> integr (0.01);
+	int count = 0, calls = 0;
+	counting_sinus f = { &count };
+	counting_batch_sinus g = { &calls };
+
+	// пакетная функция вызывается один раз, а результат совпадает с поточечным
+	BOOST_CHECK_EQUAL( integr.integrate_batch (g, 0.5, 2.5), integr.integrate (f, 0.5, 2.5) );
+	BOOST_CHECK_EQUAL( calls, 1 );
+
+	std::vector<long double> result, expected;
+	integr.integrate_range_batch (g, 0.5, 0.1, 20, result);
+	integr.integrate_range (f, 0.5, 0.1, 20, expected);
+	BOOST_CHECK_EQUAL( calls, 2 );
+	BOOST_CHECK_EQUAL_COLLECTIONS( result.begin(), result.end(), expected.begin(), expected.end() );
+}
+
+
+BOOST_AUTO_TEST_CASE( workspace_test )
+{
+	simpson_integrator<long double> integr (0.01);
+	int calls = 0;
+	counting_batch_sinus g = { &calls };
+	integration_workspace<long double> workspace;
+
+	// с рабочими массивами результат тот же, а массивы не пересоздаются
+	std::vector<long double> result, expected;
+	integr.integrate_range_batch (g, 0.5, 0.1, 20, result, workspace);
+	integr.integrate_range_batch (g, 0.5, 0.1, 20, expected);
+	BOOST_CHECK_EQUAL_COLLECTIONS( result.begin(), result.end(), expected.begin(), expected.end() );
+	BOOST_CHECK_EQUAL( workspace.xs.size(), 201u );
+
+	const long double * xs = &workspace.xs[0];
+	BOOST_CHECK_EQUAL( integr.integrate_batch (g, 0.5, 1.5, workspace), integr.integrate_batch (g, 0.5, 1.5) );
+	integr.integrate_range_batch (g, 1.5, 0.1, 20, result, workspace);
+	BOOST_CHECK_EQUAL( workspace.xs.size(), 201u );
+	BOOST_CHECK( &workspace.xs[0] == xs );
+}
+
+
+BOOST_AUTO_TEST_CASE( counters_test )
+{
+	simpson_integrator<long double> integr (0.01);
+	int count = 0, calls = 0;
+	counting_sinus f = { &count };
+	counting_batch_sinus g = { &calls };
+	std::vector<long double> result;
+
+	integr.integrate (f, 0.5, 1.5);
+	integr.integrate_range (f, 0.5, 0.1, 20, result);
+	integr.integrate_range_batch (g, 0.5, 0.1, 20, result);
+
+	// счётчики интегратора совпадают с реальным числом вычислений функции
+	BOOST_CHECK_EQUAL( integr.get_total_integrals_count(), 41u );
+	BOOST_CHECK_EQUAL( integr.get_total_evaluations_count(), (unsigned) count + 201 );
+
+	integr.reset_counters();
+	BOOST_CHECK_EQUAL( integr.get_total_integrals_count(), 0u );
+	BOOST_CHECK_EQUAL( integr.get_total_evaluations_count(), 0u );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,86 @@
+/** \file artifical_input.cpp
+    \brief Юнит-тесты для файла "math_modelling/artifical_input/artifical_input.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "../../../math_modelling/artifical_input/artifical_input.hpp"
+#include "../../../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../../../types/quaternion.hpp"
+#include "../../../types/vector3.hpp"
+
+
+namespace {
+
+
+//! Источник с постоянной угловой скоростью: интеграл на любом отрезке длины step одинаков.
+class constant_input : public artifical_input<quaternion,vector3> {
+
+protected:
+
+	virtual vector3 internal_get_integrated_ (long double, long double) {
+		// значение не зависит от округления концов отрезка и не представимо точно
+		return vector3 (1, 2, 3) * (1.0L / 3);
+	}
+
+	virtual quaternion internal_get_exact_solution_ (long double) {
+		return quaternion (1);
+	}
+
+}; // class constant_input
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( artifical_input_test )
+
+
+BOOST_AUTO_TEST_CASE( precompute_integrated_test )
+{
+	// на длинной таблице накопленные суммы велики, а их разности малы;
+	// с учётом поправок разности совпадают с исходными интегралами
+	const long double step = 0.01;
+	const size_t count = 200000;
+	constant_input input;
+	input.precompute_integrated (step, step * count);
+
+	vector3 expected = vector3 (1, 2, 3) * (1.0L / 3);
+	std::vector<vector3> range;
+	input.get_input_data()->get_integrated_range (0, step, count, range);
+
+	long double max_error = 0;
+	for (size_t k=0; k<count; ++k)
+		max_error = std::max (max_error, distance (range[k], expected));
+	BOOST_CHECK_SMALL( max_error, 4 * std::numeric_limits<long double>::epsilon() );
+	BOOST_CHECK_EQUAL( input.get_counters().integrand_evaluations, 0u );
+	BOOST_CHECK_EQUAL( input.get_counters().unmetered_integrated_calls, count );
+}
+
+
+BOOST_AUTO_TEST_CASE( counters_test )
+{
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (0.1, 0.2, 0.3),
+		plane_angles (1, 2, 3)
+	);
+	std::vector<vector3> range;
+
+	// численное интегрирование: все вычисления учтены
+	input.get_input_data()->get_integrated_range (0, 0.01, 10, range);
+	input.get_input_data()->get_integrated (0, 0.01);
+	BOOST_CHECK_EQUAL( input.get_counters().integrated_calls, 11u );
+	BOOST_CHECK_EQUAL( input.get_counters().integrand_evaluations, input.get_integrator()->get_total_evaluations_count() );
+	BOOST_CHECK_EQUAL( input.get_counters().unmetered_integrated_calls, 0u );
+
+	// аналитические приращения получены без вычислений подынтегральной функции
+	input.reset_counters();
+	input.set_analytic_increments (true);
+	input.get_input_data()->get_integrated_range (0, 0.01, 10, range);
+	BOOST_CHECK_EQUAL( input.get_counters().integrand_evaluations, 0u );
+	BOOST_CHECK_EQUAL( input.get_counters().unmetered_integrated_calls, 10u );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
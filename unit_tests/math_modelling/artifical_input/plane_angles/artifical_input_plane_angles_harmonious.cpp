@@ -0,0 +1,43 @@
+/** \file artifical_input_plane_angles_harmonious.cpp
+    \brief Юнит-тесты для файла "math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include "../../../../integrator/integration_rules.hpp"
+#include "../../../../math_modelling/artifical_input/plane_angles/artifical_input_plane_angles_harmonious.hpp"
+#include "../../../../types/vector3.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( artifical_input_plane_angles_harmonious_test )
+
+
+BOOST_AUTO_TEST_CASE( analytic_increments_test )
+{
+	// аналитические приращения совпадают с интегралом по мелкой сетке
+	artifical_input_plane_angles_harmonious input (
+		plane_angles (0.3, 0.2, 0.4),
+		plane_angles (1, 2, 3),
+		plane_angles (0.1, 0.5, -0.2)
+	);
+	input.set_analytic_increments (true);
+	gauss_legendre_rule<5> rule (1E-3L);
+
+	// короткий, средний и длинный отрезки
+	const long double intervals[][2] = { { 1.3L, 1.31L }, { 0.25L, 2.75L }, { 0, 50 } };
+	for (size_t i=0; i<sizeof (intervals) / sizeof (intervals[0]); ++i) {
+		long double t1 = intervals[i][0], t2 = intervals[i][1];
+		vector3 expected = input.integrate_omega (rule, t1, t2);
+		BOOST_CHECK_SMALL( distance (input.get_input_data()->get_integrated (t1, t2), expected), 1E-16L );
+
+		// отрезок в обратном направлении
+		BOOST_CHECK_SMALL( distance (input.get_input_data()->get_integrated (t2, t1), -expected), 1E-16L );
+	}
+
+	// отрезок нулевой длины
+	vector3 zero = input.get_input_data()->get_integrated (2, 2);
+	BOOST_CHECK_EQUAL( zero[0], 0 );
+	BOOST_CHECK_EQUAL( zero[1], 0 );
+	BOOST_CHECK_EQUAL( zero[2], 0 );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,43 @@
+/** \file biquaternion.cpp
+    \brief Юнит-тесты для файла "types/biquaternion.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include "../../types/biquaternion.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( biquaternion_test )
+
+
+//! Проверяет, что бикватернионы a и b совпадают побитово.
+static void check_equal (const biquaternion & a, const biquaternion & b) {
+	BOOST_CHECK_EQUAL (a.a, b.a);
+	BOOST_CHECK_EQUAL (a.b, b.b);
+}
+
+
+BOOST_AUTO_TEST_CASE( compound_operators_test )
+{
+	biquaternion
+		p (quaternion (1, 2, 3, 4), quaternion (0.5, -1, 2, 0.25)),
+		q (quaternion (-0.75, 1, 0.5, 2), quaternion (3, 0.125, -2, 1));
+
+	biquaternion r = p;
+	r += q;
+	check_equal (r, p + q);
+	r -= q;
+	check_equal (r, p);
+	r *= 3;
+	check_equal (r, p * 3);
+	r /= 3;
+	check_equal (r, p);
+	r *= q;
+	check_equal (r, p * q);
+
+	// умножение на самого себя
+	r = p;
+	r *= r;
+	check_equal (r, p * p);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,38 @@
+/** \file dual_number.cpp
+    \brief Юнит-тесты для файла "types/dual_number.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include "../../types/dual_number.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( dual_number_test )
+
+
+//! Проверяет, что дуальные числа a и b совпадают побитово.
+static void check_equal (const dual_number & a, const dual_number & b) {
+	BOOST_CHECK_EQUAL (a.real, b.real);
+	BOOST_CHECK_EQUAL (a.imag, b.imag);
+}
+
+
+BOOST_AUTO_TEST_CASE( compound_operators_test )
+{
+	dual_number a (1.5, -2), b (0.25, 3);
+
+	dual_number n = a;
+	n += b;
+	check_equal (n, a + b);
+	n -= b;
+	check_equal (n, a);
+	n *= 3;
+	check_equal (n, a * 3);
+	n /= 3;
+	check_equal (n, a);
+
+	// сложение с самим собой
+	n += n;
+	check_equal (n, a + a);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
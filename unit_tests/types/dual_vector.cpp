@@ -0,0 +1,40 @@
+/** \file dual_vector.cpp
+    \brief Юнит-тесты для файла "types/dual_vector.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include "../../types/dual_vector.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( dual_vector_test )
+
+
+//! Проверяет, что дуальные векторы a и b совпадают побитово.
+static void check_equal (const dual_vector & a, const dual_vector & b) {
+	for (int c=0; c<3; ++c) {
+		BOOST_CHECK_EQUAL (a.real[c], b.real[c]);
+		BOOST_CHECK_EQUAL (a.imag[c], b.imag[c]);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( compound_operators_test )
+{
+	dual_vector a (vector3 (1, 2, 3), vector3 (-1, 0.5, 4)), b (vector3 (0.25, -3, 1), vector3 (2, 2, -0.75));
+
+	dual_vector v = a;
+	v += b;
+	check_equal (v, a + b);
+	v -= b;
+	check_equal (v, a);
+	v *= 3;
+	check_equal (v, a * 3);
+	v /= 3;
+	check_equal (v, a);
+
+	// вычитание самого себя
+	v -= v;
+	check_equal (v, dual_vector());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,8 @@
     \brief Юнит-тесты для файла "types/quaternion.hpp".
 */
 #include <boost/test/unit_test.hpp>
+#include <boost/static_assert.hpp>
+#include "../../types/matrix33.hpp"
 #include "../../types/quaternion.hpp"
 
 
@@ -114,8 +116,11 @@ BOOST_AUTO_TEST_CASE( operator_brackets_test )
 	BOOST_CHECK_CLOSE (q[2], 7, tolerance);
 	BOOST_CHECK_CLOSE (q[3], 8, tolerance);
 
+	// индекс проверяется только в отладочной сборке
+#ifndef NDEBUG
 	BOOST_CHECK_THROW (q[-1], std::invalid_argument);
 	BOOST_CHECK_THROW (q[4], std::invalid_argument);
+#endif
 }
 
 
@@ -192,6 +197,29 @@ BOOST_AUTO_TEST_CASE( operator_mult_quaternion_test )
 }
 
 
+BOOST_AUTO_TEST_CASE( compound_operators_test )
+{
+	quaternion a (1, 2, 3, 4), b (0.5, -1, 2, 0.25);
+
+	quaternion q = a;
+	q += b;
+	BOOST_CHECK_EQUAL (q, a + b);
+	q -= b;
+	BOOST_CHECK_EQUAL (q, a);
+	q *= 3;
+	BOOST_CHECK_EQUAL (q, a * 3);
+	q /= 3;
+	BOOST_CHECK_EQUAL (q, a);
+	q *= b;
+	BOOST_CHECK_EQUAL (q, a * b);
+
+	// умножение на самого себя
+	q = a;
+	q *= q;
+	BOOST_CHECK_EQUAL (q, a * a);
+}
+
+
 BOOST_AUTO_TEST_CASE( operator_minus_unary_test )
 {
 	quaternion q = - quaternion (1, 2, 3, 4);
@@ -254,4 +282,45 @@ BOOST_AUTO_TEST_CASE( distance_test )
 }
 
 
+BOOST_AUTO_TEST_CASE( scalar_conversion_test )
+{
+	quaternion a (1.0L / 3, 2, 3, 4);
+	basic_quaternion<double> b (a);
+	basic_quaternion<float> c (a);
+
+	BOOST_CHECK_EQUAL (b.w, (double) a.w);
+	BOOST_CHECK_EQUAL (c.w, (float) a.w);
+	BOOST_CHECK_EQUAL (quaternion (b), quaternion (1.0 / 3, 2, 3, 4));
+	BOOST_CHECK_SMALL (distance (b * b, basic_quaternion<double> (a * a)), 1E-14);
+}
+
+
+
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+
+BOOST_AUTO_TEST_CASE( constexpr_test )
+{
+	// арифметика над value-типами вычисляется на этапе компиляции
+	typedef basic_quaternion<double> q_type;
+	typedef basic_vector3<double> v_type;
+
+	BOOST_STATIC_ASSERT( q_type::get_unit().w == 1 && q_type::get_unit().norm() == 1 );
+	BOOST_STATIC_ASSERT( (q_type (1, 2, 3, 4) + q_type (1)).w == 2 );
+	BOOST_STATIC_ASSERT( q_type (0.5, v_type (1, 0, 0)).get_vector().x == 1 );
+	// для double и float произведение идёт через векторные quaternion_kernels, они не constexpr
+	BOOST_STATIC_ASSERT( (quaternion (1, 2, 3, 4) * quaternion (1, 2, 3, 4).conjugate()).w == 30 );
+	BOOST_STATIC_ASSERT( scalar_quaternion_kernels<double>::multiply (q_type (0, 1, 0, 0), q_type (0, 0, 1, 0)).z == 1 );
+	BOOST_STATIC_ASSERT( q_type (1, 2, 3, 4)[3] == 4 );
+
+	BOOST_STATIC_ASSERT( crossProduct (v_type (1, 0, 0), v_type (0, 1, 0)).z == 1 );
+	BOOST_STATIC_ASSERT( dotProduct (v_type (1, 2, 3), v_type (4, 5, 6)) == 32 );
+
+	BOOST_STATIC_ASSERT( (basic_matrix33<double> (1, 0, 0, 0, 2, 0, 0, 0, 3) * v_type (1, 1, 1)).z == 3 );
+	BOOST_STATIC_ASSERT( (basic_matrix33<double> (1, 2, 3, 4, 5, 6, 7, 8, 9) * basic_matrix33<double>())(1, 1) == 0 );
+
+	BOOST_CHECK (true);
+}
+
+#endif // ifndef BOOST_NO_CXX14_CONSTEXPR
+
 BOOST_AUTO_TEST_SUITE_END()
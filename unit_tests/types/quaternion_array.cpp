@@ -0,0 +1,93 @@
+/** \file quaternion_array.cpp
+    \brief Юнит-тесты для файла "types/quaternion_array.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <vector>
+#include "../../types/quaternion_array.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( quaternion_array_test )
+
+
+//! Заполняет массивы a (в структуре по компонентам) и aos (кватернион за кватернионом) одними и теми же значениями.
+static void fill (quaternion_array & a, std::vector<quaternion> & aos, size_t count, long double seed) {
+	a.resize (count);
+	aos.resize (count);
+	for (size_t i=0; i<count; ++i) {
+		long double t = seed + 0.1L * i;
+		aos[i] = normalize (quaternion (cos (t), sin (t), 0.5L * cos (2 * t), 0.25L));
+		a[i] = aos[i];
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( element_access_test )
+{
+	quaternion_array a;
+	a.push_back (quaternion (1, 2, 3, 4));
+	a.push_back (quaternion (5, 6, 7, 8));
+
+	BOOST_CHECK_EQUAL( a.size(), 2u );
+	BOOST_CHECK_EQUAL( a.get (1), quaternion (5, 6, 7, 8) );
+	BOOST_CHECK_EQUAL( a.x[0], 2 );
+
+	a[0] = quaternion (-1, -2, -3, -4);
+	a[1] = a[0];
+	BOOST_CHECK_EQUAL( a.get (1), quaternion (-1, -2, -3, -4) );
+	BOOST_CHECK_EQUAL( a.z[1], -4 );
+}
+
+
+BOOST_AUTO_TEST_CASE( batch_operations_test )
+{
+	// пакетные операции дают те же результаты, что и операции над отдельными кватернионами
+	const size_t count = 1000;
+	quaternion_array a, b, product;
+	std::vector<quaternion> aos_a, aos_b;
+	fill (a, aos_a, count, 0);
+	fill (b, aos_b, count, 1);
+
+	batch_multiply (a, b, product);
+	std::vector<long double> distances;
+	batch_distance (a, b, distances);
+	for (size_t i=0; i<count; ++i) {
+		BOOST_CHECK_EQUAL( product.get (i), aos_a[i] * aos_b[i] );
+		BOOST_CHECK_EQUAL( distances[i], distance (aos_a[i], aos_b[i]) );
+	}
+
+	// умножение на месте
+	batch_multiply (a, b, a);
+	for (size_t i=0; i<count; ++i)
+		BOOST_CHECK_EQUAL( a.get (i), product.get (i) );
+
+	quaternion_array scaled;
+	for (size_t i=0; i<count; ++i)
+		scaled.push_back (aos_b[i] * 3);
+	batch_normalize (scaled);
+	for (size_t i=0; i<count; ++i)
+		BOOST_CHECK_CLOSE( scaled.get (i).length(), 1, 1E-14 );
+}
+
+
+BOOST_AUTO_TEST_CASE( plane_angles_test )
+{
+	std::vector<plane_angles> angles;
+	for (int i=0; i<10; ++i)
+		angles.push_back (plane_angles (0.1L * i, 0.05L * i, -0.02L * i));
+
+	quaternion_array a;
+	from_plane_angles (angles, a);
+	std::vector<plane_angles> back;
+	to_plane_angles (a, back);
+
+	BOOST_REQUIRE_EQUAL( back.size(), angles.size() );
+	for (size_t i=0; i<angles.size(); ++i) {
+		BOOST_CHECK_EQUAL( a.get (i), quaternion (angles[i]) );
+		BOOST_CHECK_SMALL( back[i].psi - angles[i].psi, 1E-12L );
+		BOOST_CHECK_SMALL( back[i].teta - angles[i].teta, 1E-12L );
+		BOOST_CHECK_SMALL( back[i].gamma - angles[i].gamma, 1E-12L );
+	}
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+/** \file quaternion_simd.cpp
+    \brief Юнит-тесты для файла "types/quaternion_simd.hpp": сравнение с покомпонентной реализацией scalar_quaternion_kernels.
+*/
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+#include <limits>
+#include "../../types/quaternion.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( quaternion_simd_test )
+
+
+//! Число случайных пар кватернионов в каждом тесте.
+static const int samples = 10000;
+
+
+//! Возвращает кватернион со случайными компонентами из [-scale; scale].
+template <typename T>
+basic_quaternion<T> random_quaternion (T scale) {
+	basic_quaternion<T> q;
+	for (int c=0; c<4; ++c)
+		q[c] = scale * (2 * T (std::rand()) / RAND_MAX - 1);
+	return q;
+}
+
+
+/** Проверяет, что a и b отличаются не больше чем на несколько единиц последнего разряда относительно magnitude.
+ *
+ * Допуск нужен на случай, когда компилятор сокращает умножение-сложение
+ * в покомпонентной реализации в FMA (например, с -march=native); иначе
+ * результаты совпадают побитово.
+ */
+template <typename T>
+void check_close (const basic_quaternion<T> & a, const basic_quaternion<T> & b, T magnitude) {
+	T tolerance = 4 * std::numeric_limits<T>::epsilon() * magnitude;
+	for (int c=0; c<4; ++c)
+		BOOST_CHECK_SMALL( a[c] - b[c], tolerance );
+}
+
+
+//! Сравнивает quaternion_kernels<T> с scalar_quaternion_kernels<T> на случайных кватернионах.
+template <typename T>
+void check_kernels() {
+	typedef quaternion_kernels<T> simd;
+	typedef scalar_quaternion_kernels<T> scalar;
+
+	std::srand (1);
+	T epsilon = std::numeric_limits<T>::epsilon();
+	for (int i=0; i<samples; ++i) {
+		basic_quaternion<T> a = random_quaternion<T> (T (i % 2 ? 1 : 1000)),
+			b = random_quaternion<T> (1);
+		T magnitude = a.length() * b.length();
+
+		check_close (simd::multiply (a, b), scalar::multiply (a, b), magnitude);
+		check_close (simd::conjugate_multiply (a, b), scalar::conjugate_multiply (a, b), magnitude);
+		check_close (simd::normalize (a), scalar::normalize (a), T (1));
+		BOOST_CHECK_SMALL( simd::distance (a, b) - scalar::distance (a, b), 4 * epsilon * (a.length() + b.length()) );
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( double_test )
+{
+	BOOST_TEST_MESSAGE( "quaternion_kernels<double>: " << quaternion_kernels<double>::get_instruction_set() );
+	check_kernels<double>();
+}
+
+
+BOOST_AUTO_TEST_CASE( float_test )
+{
+	BOOST_TEST_MESSAGE( "quaternion_kernels<float>: " << quaternion_kernels<float>::get_instruction_set() );
+	check_kernels<float>();
+}
+
+
+BOOST_AUTO_TEST_CASE( operators_test )
+{
+	// операторы и свободные функции идут через quaternion_kernels
+	basic_quaternion<double> a (0.5, -1, 2, 0.25), b (1, 0.5, -0.5, 3);
+
+	BOOST_CHECK_EQUAL( a * b, scalar_quaternion_kernels<double>::multiply (a, b) );
+	BOOST_CHECK_EQUAL( conjugate_multiply (a, b), a.conjugate() * b );
+	BOOST_CHECK_CLOSE( normalize (a).length(), 1.0, 1E-12 );
+	BOOST_CHECK_CLOSE( distance (a, b), (a - b).length(), 1E-12 );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
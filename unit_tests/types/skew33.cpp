@@ -0,0 +1,87 @@
+/** \file skew33.cpp
+    \brief Юнит-тесты для файла "types/skew33.hpp": сравнение с вычислениями через matrix33.
+*/
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+#include "../../types/skew33.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( skew33_test )
+
+
+//! Возвращает вектор со случайными компонентами из [-1; 1].
+static vector3 random_vector() {
+	vector3 v;
+	for (int c=0; c<3; ++c)
+		v[c] = 2 * (long double) std::rand() / RAND_MAX - 1;
+	return v;
+}
+
+
+//! Проверяет, что все элементы матриц a и b совпадают.
+static void check_equal (const matrix33 & a, const matrix33 & b) {
+	for (int i=0; i<3; ++i)
+		for (int j=0; j<3; ++j)
+			BOOST_CHECK_EQUAL( a (i, j), b (i, j) );
+}
+
+
+BOOST_AUTO_TEST_CASE( elements_test )
+{
+	skew33 m (vector3 (1, 2, 3));
+	matrix33 full = m;
+
+	BOOST_CHECK_EQUAL( m (0, 0), 0 );
+	BOOST_CHECK_EQUAL( m (0, 1), -3 );
+	BOOST_CHECK_EQUAL( m (0, 2), 2 );
+	BOOST_CHECK_EQUAL( m (1, 0), 3 );
+	BOOST_CHECK_EQUAL( m (1, 2), -1 );
+	BOOST_CHECK_EQUAL( m (2, 0), -2 );
+	BOOST_CHECK_EQUAL( m (2, 1), 1 );
+	for (int i=0; i<3; ++i)
+		for (int j=0; j<3; ++j)
+			BOOST_CHECK_EQUAL( full (i, j), m (i, j) );
+
+	BOOST_CHECK_EQUAL( skew33() (1, 2), 0 );
+
+#ifndef NDEBUG
+	BOOST_CHECK_THROW( m (3, 0), std::invalid_argument );
+	BOOST_CHECK_THROW( m (0, -1), std::invalid_argument );
+#endif
+}
+
+
+BOOST_AUTO_TEST_CASE( products_test )
+{
+	// произведения совпадают с matrix33 побитово
+	std::srand (1);
+	for (int i=0; i<1000; ++i) {
+		vector3 a = random_vector(), b = random_vector(), u = random_vector();
+		skew33 A (a), B (b);
+		matrix33 full_A = A, full_B = B;
+
+		BOOST_CHECK_EQUAL( distance (A * u, full_A * u), 0 );
+		BOOST_CHECK_EQUAL( distance (A * u, crossProduct (a, u)), 0 );
+		check_equal (A * B, full_A * full_B);
+		BOOST_CHECK_EQUAL( distance (A * B * u, full_A * full_B * u), 0 );
+		BOOST_CHECK_EQUAL( distance ((A + B) * u, (full_A + full_B) * u), 0 );
+		BOOST_CHECK_EQUAL( distance ((A - B) * u, (full_A - full_B) * u), 0 );
+		BOOST_CHECK_EQUAL( distance ((0.3L * A) * u, (0.3L * full_A) * u), 0 );
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( compound_operators_test )
+{
+	skew33 m (vector3 (1, 2, 3));
+	m += skew33 (vector3 (1, 1, 1));
+	m *= 2;
+	BOOST_CHECK_EQUAL( m (0, 1), -8 );
+	m /= 2;
+	m -= skew33 (vector3 (1, 2, 3));
+	BOOST_CHECK_EQUAL( m (0, 1), -1 );
+	BOOST_CHECK_EQUAL( (-m) (0, 1), 1 );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,7 @@
     \brief Юнит-тесты для файла "types/vector3.hpp".
 */
 #include <boost/test/unit_test.hpp>
+#include <cmath>
 #include "../../types/vector3.hpp"
 
 
@@ -74,8 +75,11 @@ BOOST_AUTO_TEST_CASE( operator_brackets_test )
 	BOOST_CHECK_CLOSE (v[1], 5, tolerance);
 	BOOST_CHECK_CLOSE (v[2], 6, tolerance);
 
+	// индекс проверяется только в отладочной сборке
+#ifndef NDEBUG
 	BOOST_CHECK_THROW (v[-1], std::invalid_argument);
 	BOOST_CHECK_THROW (v[3], std::invalid_argument);
+#endif
 }
 
 
@@ -155,6 +159,28 @@ BOOST_AUTO_TEST_CASE( operator_minus_eq_test )
 }
 
 
+BOOST_AUTO_TEST_CASE( operator_mult_eq_double_test )
+{
+	vector3 v = vector3 (1, 2, 3);
+	v *= 10;
+
+	BOOST_CHECK_CLOSE (v[0], 10, tolerance);
+	BOOST_CHECK_CLOSE (v[1], 20, tolerance);
+	BOOST_CHECK_CLOSE (v[2], 30, tolerance);
+}
+
+
+BOOST_AUTO_TEST_CASE( operator_div_eq_double_test )
+{
+	vector3 v = vector3 (10, 20, 30);
+	v /= 10;
+
+	BOOST_CHECK_CLOSE (v[0], 1, tolerance);
+	BOOST_CHECK_CLOSE (v[1], 2, tolerance);
+	BOOST_CHECK_CLOSE (v[2], 3, tolerance);
+}
+
+
 BOOST_AUTO_TEST_CASE( norm_test )
 {
 	vector3 v = vector3 (1, 2, 3);
@@ -171,6 +197,15 @@ BOOST_AUTO_TEST_CASE( length_test )
 }
 
 
+BOOST_AUTO_TEST_CASE( long_double_length_test )
+{
+	// длина считается в long double, а не через sqrt (double)
+	basic_vector3<long double> v (1, 1, 0);
+
+	BOOST_CHECK_EQUAL (v.length(), std::sqrt (2.0L));
+}
+
+
 BOOST_AUTO_TEST_CASE( distance_test )
 {
 	vector3 a = vector3 (1, 2, 3);
@@ -0,0 +1,47 @@
+/** \file vector3_array.cpp
+    \brief Юнит-тесты для файла "types/vector3_array.hpp".
+*/
+#include <boost/test/unit_test.hpp>
+#include <vector>
+#include "../../types/vector3_array.hpp"
+
+
+BOOST_AUTO_TEST_SUITE( vector3_array_test )
+
+
+BOOST_AUTO_TEST_CASE( element_access_test )
+{
+	vector3_array a (2);
+	a[0] = vector3 (1, 2, 3);
+	a.push_back (vector3 (4, 5, 6));
+
+	BOOST_CHECK_EQUAL( a.size(), 3u );
+	BOOST_CHECK_EQUAL( a.y[0], 2 );
+	BOOST_CHECK_EQUAL( a.get (1).length(), 0 );
+	BOOST_CHECK_EQUAL( vector3 (a[2]).z, 6 );
+}
+
+
+BOOST_AUTO_TEST_CASE( batch_operations_test )
+{
+	vector3_array a, b;
+	for (int i=0; i<100; ++i) {
+		a.push_back (vector3 (i, 1, -2 * i));
+		b.push_back (vector3 (0.5L, i, 3));
+	}
+
+	std::vector<long double> dots, lengths;
+	batch_dot (a, b, dots);
+	batch_length (a, lengths);
+	for (size_t i=0; i<a.size(); ++i) {
+		BOOST_CHECK_EQUAL( dots[i], dotProduct (a.get (i), b.get (i)) );
+		BOOST_CHECK_EQUAL( lengths[i], a.get (i).length() );
+	}
+
+	batch_normalize (a);
+	for (size_t i=0; i<a.size(); ++i)
+		BOOST_CHECK_CLOSE( a.get (i).length(), 1, 1E-12 );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,4 +20,14 @@ BOOST_AUTO_TEST_CASE( sqr_test )
 }
 
 
+BOOST_AUTO_TEST_CASE( distance_test )
+{
+	const double tolerance = 1E-7;
+
+    BOOST_CHECK_CLOSE( distance ((long double)2, (long double)5), 3, tolerance );
+    BOOST_CHECK_CLOSE( distance ((long double)5, (long double)2), 3, tolerance );
+    BOOST_CHECK_SMALL( distance ((long double)-1, (long double)-1), (long double)tolerance );
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -7,6 +7,9 @@
 #define UTILITY_FUNCTIONS_H
 
 
+#include <cmath>
+
+
 //! Вычисляет квадрат числа.
 template <class T>
 inline T sqr (const T & x) {
@@ -14,4 +17,10 @@ inline T sqr (const T & x) {
 }
 
 
+//! Возвращает расстояние между числами - т.е. модуль их разности.
+inline long double distance (long double a, long double b) {
+	return fabs (a - b);
+}
+
+
 #endif // ifndef UTILITY_FUNCTIONS_H